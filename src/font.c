@@ -50,6 +50,11 @@
  *
  * Font-backends must take into account that this API must be thread-safe as it
  * is shared between different threads to reduce memory-footprint.
+ *
+ * Glyph caches of backends and text-renderers are bounded by
+ * kmscon_font_get_cache_limit() and evict least-recently-used glyphs. A glyph
+ * returned by kmscon_font_render() stays valid until the next epoch is started
+ * via kmscon_font_next_epoch(), which the text layer does once per frame.
  */
 
 #include <errno.h>
@@ -67,6 +72,10 @@
 
 static struct shl_register font_reg = SHL_REGISTER_INIT(font_reg);
 
+/* per-cache glyph budget in bytes (0 is unlimited) and the current frame */
+static size_t font_cache_limit = 8 * 1024 * 1024;
+static unsigned long font_epoch = 1;
+
 /**
  * kmscon_font_attr_normalize:
  * @attr: Attribute to normalize
@@ -136,6 +145,69 @@ bool kmscon_font_attr_match(const struct kmscon_font_attr *a1,
 	return true;
 }
 
+/**
+ * kmscon_glyph_set_ink:
+ * @glyph: Glyph to compute the ink box of
+ *
+ * Scans the bitmap of @glyph and sets @glyph->ink to the smallest rectangle
+ * that contains all non-zero pixels. Renderers fill the rest of the cell with
+ * the background color and blend only this part. The horizontal bounds of
+ * UTERM_FORMAT_MONO glyphs are rounded to whole bytes so the ink box always
+ * starts at a byte boundary of the bitmap.
+ * Font backends must call this whenever they create or modify a glyph bitmap.
+ */
+SHL_EXPORT
+void kmscon_glyph_set_ink(struct kmscon_glyph *glyph)
+{
+	const struct uterm_video_buffer *buf;
+	const uint8_t *row;
+	unsigned int x, y, x0, x1, y0, y1, len;
+	bool mono;
+
+	if (!glyph)
+		return;
+
+	buf = &glyph->buf;
+	mono = buf->format == UTERM_FORMAT_MONO;
+	len = mono ? (buf->width + 7) / 8 : buf->width;
+	x0 = len;
+	x1 = 0;
+	y0 = buf->height;
+	y1 = 0;
+
+	for (y = 0; y < buf->height; ++y) {
+		row = &buf->data[y * buf->stride];
+		for (x = 0; x < len; ++x) {
+			if (!row[x])
+				continue;
+			if (x < x0)
+				x0 = x;
+			if (x >= x1)
+				x1 = x + 1;
+			if (y < y0)
+				y0 = y;
+			y1 = y + 1;
+		}
+	}
+
+	if (x0 >= x1 || y0 >= y1) {
+		memset(&glyph->ink, 0, sizeof(glyph->ink));
+		return;
+	}
+
+	if (mono) {
+		x0 *= 8;
+		x1 *= 8;
+		if (x1 > buf->width)
+			x1 = buf->width;
+	}
+
+	glyph->ink.x = x0;
+	glyph->ink.y = y0;
+	glyph->ink.width = x1 - x0;
+	glyph->ink.height = y1 - y0;
+}
+
 static inline void kmscon_font_destroy(void *data)
 {
 	const struct kmscon_font_ops *ops = data;
@@ -304,6 +376,7 @@ static int new_font(struct kmscon_font *font,
  *
  * Returns: 0 on success, error code on failure
  */
+SHL_EXPORT
 int kmscon_font_find(struct kmscon_font **out,
 		     const struct kmscon_font_attr *attr,
 		     const char *backend)
@@ -333,6 +406,11 @@ int kmscon_font_find(struct kmscon_font **out,
 			goto err_free;
 	}
 
+	ret = kmscon_font_box_new(&font->box, font->attr.width,
+				  font->attr.height);
+	if (ret)
+		log_warning("cannot create box-drawing glyphs (%d)", ret);
+
 	log_debug("using: be: %s nm: %s ppi: %u pt: %u b: %d i: %d he: %u wt: %u",
 		  font->ops->name, font->attr.name, font->attr.ppi,
 		  font->attr.points, font->attr.bold, font->attr.italic,
@@ -366,6 +444,7 @@ void kmscon_font_ref(struct kmscon_font *font)
  * This decreases the reference count of @font by one. If it drops to zero, the
  * object is freed.
  */
+SHL_EXPORT
 void kmscon_font_unref(struct kmscon_font *font)
 {
 	if (!font || !font->ref || --font->ref)
@@ -374,6 +453,7 @@ void kmscon_font_unref(struct kmscon_font *font)
 	log_debug("freeing font");
 	if (font->ops->destroy)
 		font->ops->destroy(font);
+	kmscon_font_box_free(font->box);
 	shl_register_record_unref(font->record);
 	free(font);
 }
@@ -392,6 +472,10 @@ void kmscon_font_unref(struct kmscon_font *font)
  * dropped.
  * If the glyph is no available in this font-set, then -ERANGE is returned.
  *
+ * Box-drawing characters, block elements and braille patterns are not passed
+ * to the backend but drawn procedurally for the cell size of @font, see
+ * font_box.c.
+ *
  * Returns: 0 on success, negative error code on failure
  */
 SHL_EXPORT
@@ -402,9 +486,45 @@ int kmscon_font_render(struct kmscon_font *font,
 	if (!font || !out || !ch || !len)
 		return -EINVAL;
 
+	if (len == 1 && font->box && kmscon_font_box_covers(*ch))
+		return kmscon_font_box_render(font->box, *ch, out);
+
 	return font->ops->render(font, id, ch, len, out);
 }
 
+/**
+ * kmscon_font_lookup:
+ * @font: Valid font object
+ * @id: Unique ID that identifies @ch globally
+ * @ch: Symbol to find a glyph for
+ * @len: Length of @ch
+ * @out: Output buffer for glyph
+ *
+ * Same as kmscon_font_render() but this never waits for a glyph to be
+ * rasterized. If the glyph is not cached by the font, -EAGAIN is returned and
+ * the caller may request it via kmscon_font_render_batch() or render it later.
+ * Backends without a lookup operation are cheap enough to render directly.
+ *
+ * Returns: 0 on success, -EAGAIN if the glyph is not ready, other negative
+ * error codes on failure
+ */
+SHL_EXPORT
+int kmscon_font_lookup(struct kmscon_font *font,
+		       uint32_t id, const uint32_t *ch, size_t len,
+		       const struct kmscon_glyph **out)
+{
+	if (!font || !out || !ch || !len)
+		return -EINVAL;
+
+	if (len == 1 && font->box && kmscon_font_box_covers(*ch))
+		return kmscon_font_box_render(font->box, *ch, out);
+
+	if (!font->ops->lookup)
+		return font->ops->render(font, id, ch, len, out);
+
+	return font->ops->lookup(font, id, ch, len, out);
+}
+
 /**
  * kmscon_font_render_empty:
  * @font: Valid font object
@@ -447,3 +567,108 @@ int kmscon_font_render_inval(struct kmscon_font *font,
 
 	return font->ops->render_inval(font, out);
 }
+
+/**
+ * kmscon_font_render_batch:
+ * @font: Valid font object
+ * @reqs: Array of glyph requests
+ * @num: Number of requests in @reqs
+ *
+ * This tells the font that the glyphs in @reqs are going to be rendered soon.
+ * Backends that support it start rasterizing all missing glyphs in the
+ * background so a following kmscon_font_render() only has to wait for the
+ * glyph it needs. This never blocks on the rasterization itself and the
+ * symbols in @reqs are copied if needed.
+ * If the backend does not support batches, this is a no-op.
+ *
+ * Returns: 0 on success, negative error code on failure
+ */
+SHL_EXPORT
+int kmscon_font_render_batch(struct kmscon_font *font,
+			     const struct kmscon_font_req *reqs, size_t num)
+{
+	if (!font || (num && !reqs))
+		return -EINVAL;
+
+	if (!font->ops->render_batch || !num)
+		return 0;
+
+	return font->ops->render_batch(font, reqs, num);
+}
+
+/**
+ * kmscon_font_get_stats:
+ * @font: Valid font object
+ * @stats: Output buffer for the statistics
+ *
+ * This returns the occupancy and the hit, miss and eviction counters of the
+ * glyph cache of @font. Faces may be shared between font objects so the
+ * counters are not necessarily specific to @font. Backends that resolve
+ * fallback faces via fontconfig also report how often the fallback face of a
+ * code-point was found in their fallback cache.
+ *
+ * Returns: 0 on success, -EOPNOTSUPP if the backend has no glyph cache
+ */
+SHL_EXPORT
+int kmscon_font_get_stats(struct kmscon_font *font,
+			  struct kmscon_glyph_stats *stats)
+{
+	if (!font || !stats)
+		return -EINVAL;
+
+	if (!font->ops->get_stats)
+		return -EOPNOTSUPP;
+
+	memset(stats, 0, sizeof(*stats));
+	font->ops->get_stats(font, stats);
+	return 0;
+}
+
+/**
+ * kmscon_font_set_cache_limit:
+ * @limit: Budget in bytes or 0 for unlimited caches
+ *
+ * This sets the memory budget of each glyph cache. Caches that already exist
+ * pick up the new limit the next time they insert a glyph.
+ */
+void kmscon_font_set_cache_limit(size_t limit)
+{
+	__atomic_store_n(&font_cache_limit, limit, __ATOMIC_RELAXED);
+}
+
+/**
+ * kmscon_font_get_cache_limit:
+ *
+ * Returns: The memory budget in bytes of each glyph cache, 0 if unlimited
+ */
+SHL_EXPORT
+size_t kmscon_font_get_cache_limit(void)
+{
+	return __atomic_load_n(&font_cache_limit, __ATOMIC_RELAXED);
+}
+
+/**
+ * kmscon_font_next_epoch:
+ *
+ * This starts a new epoch. Glyphs that were returned during the previous epochs
+ * may be evicted from now on, so this must only be called if no glyph pointers
+ * are held anymore. The text layer calls this at the beginning of each frame.
+ */
+void kmscon_font_next_epoch(void)
+{
+	__atomic_add_fetch(&font_epoch, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * kmscon_font_get_epoch:
+ *
+ * Glyph caches store the current epoch with each glyph they return and never
+ * evict glyphs of the current epoch.
+ *
+ * Returns: The current epoch
+ */
+SHL_EXPORT
+unsigned long kmscon_font_get_epoch(void)
+{
+	return __atomic_load_n(&font_epoch, __ATOMIC_ACQUIRE);
+}
@@ -41,6 +41,7 @@ struct kmscon_font_attr;
 struct kmscon_glyph;
 struct kmscon_font;
 struct kmscon_font_ops;
+struct kmscon_font_box;
 
 #define KMSCON_FONT_MAX_NAME 128
 #define KMSCON_FONT_DEFAULT_NAME "monospace"
@@ -59,9 +60,34 @@ struct kmscon_font_attr {
 void kmscon_font_attr_normalize(struct kmscon_font_attr *attr);
 bool kmscon_font_attr_match(const struct kmscon_font_attr *a1,
 			    const struct kmscon_font_attr *a2);
+void kmscon_glyph_set_ink(struct kmscon_glyph *glyph);
 
+/* Ids below this are always single code-points. Glyph caches index them in a
+ * flat array in front of their hashtables. */
+#define KMSCON_GLYPH_FAST_NUM 0x3000
+
+struct kmscon_font_req {
+	uint32_t id;
+	const uint32_t *ch;
+	size_t len;
+};
+
+struct kmscon_glyph_stats {
+	size_t size;
+	size_t limit;
+	unsigned long entries;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+	unsigned long fallback_hits;
+	unsigned long fallback_misses;
+};
+
+/* @ink is the bounding box of all set pixels in @buf, computed by
+ * kmscon_glyph_set_ink(). It is empty if the glyph has no ink at all. */
 struct kmscon_glyph {
 	struct uterm_video_buffer buf;
+	struct uterm_video_rect ink;
 	unsigned int width;
 	void *data;
 };
@@ -72,6 +98,7 @@ struct kmscon_font {
 	const struct kmscon_font_ops *ops;
 	struct kmscon_font_attr attr;
 	unsigned int baseline;
+	struct kmscon_font_box *box;
 	void *data;
 };
 
@@ -84,10 +111,17 @@ struct kmscon_font_ops {
 	int (*render) (struct kmscon_font *font,
 		       uint32_t id, const uint32_t *ch, size_t len,
 		       const struct kmscon_glyph **out);
+	int (*lookup) (struct kmscon_font *font,
+		       uint32_t id, const uint32_t *ch, size_t len,
+		       const struct kmscon_glyph **out);
 	int (*render_empty) (struct kmscon_font *font,
 			     const struct kmscon_glyph **out);
 	int (*render_inval) (struct kmscon_font *font,
 			     const struct kmscon_glyph **out);
+	int (*render_batch) (struct kmscon_font *font,
+			     const struct kmscon_font_req *reqs, size_t num);
+	void (*get_stats) (struct kmscon_font *font,
+			   struct kmscon_glyph_stats *stats);
 };
 
 int kmscon_font_register(const struct kmscon_font_ops *ops);
@@ -102,15 +136,53 @@ void kmscon_font_unref(struct kmscon_font *font);
 int kmscon_font_render(struct kmscon_font *font,
 		       uint32_t id, const uint32_t *ch, size_t len,
 		       const struct kmscon_glyph **out);
+int kmscon_font_lookup(struct kmscon_font *font,
+		       uint32_t id, const uint32_t *ch, size_t len,
+		       const struct kmscon_glyph **out);
 int kmscon_font_render_empty(struct kmscon_font *font,
 			     const struct kmscon_glyph **out);
 int kmscon_font_render_inval(struct kmscon_font *font,
 			     const struct kmscon_glyph **out);
+int kmscon_font_render_batch(struct kmscon_font *font,
+			     const struct kmscon_font_req *reqs, size_t num);
+int kmscon_font_get_stats(struct kmscon_font *font,
+			  struct kmscon_glyph_stats *stats);
+
+void kmscon_font_set_cache_limit(size_t limit);
+size_t kmscon_font_get_cache_limit(void);
+void kmscon_font_next_epoch(void);
+unsigned long kmscon_font_get_epoch(void);
+
+/* procedural box-drawing, block and braille glyphs */
+
+static inline bool kmscon_font_box_covers(uint32_t ch)
+{
+	return (ch >= 0x2500 && ch <= 0x259f) || (ch >= 0x2800 && ch <= 0x28ff);
+}
+
+int kmscon_font_box_new(struct kmscon_font_box **out, unsigned int width,
+			unsigned int height);
+void kmscon_font_box_free(struct kmscon_font_box *box);
+int kmscon_font_box_render(struct kmscon_font_box *box, uint32_t ch,
+			   const struct kmscon_glyph **out);
+
+/* synthetic bold */
+
+int kmscon_font_new_bold(struct kmscon_font **out, struct kmscon_font *font);
+
+/* interim fonts for zooming */
+
+int kmscon_font_new_interim(struct kmscon_font **out, struct kmscon_font *font,
+			    struct kmscon_font *prev);
+int kmscon_font_interim_update(struct kmscon_font *font, unsigned int *ready);
+void kmscon_font_interim_finish(struct kmscon_font *font);
 
 /* modularized backends */
 
 extern struct kmscon_font_ops kmscon_font_8x16_ops;
 extern struct kmscon_font_ops kmscon_font_unifont_ops;
 extern struct kmscon_font_ops kmscon_font_pango_ops;
+extern struct kmscon_font_ops kmscon_font_freetype_ops;
+extern struct kmscon_font_ops kmscon_font_psf_ops;
 
 #endif /* KMSCON_FONT_H */
@@ -41,7 +41,8 @@
  * There is also no sophisticated font handling in here so this should only be
  * used as last fallback when external libraries failed. However, this also
  * means this backend is _very_ fast as no rendering is needed. Everything is
- * pre-rendered. See the big array at the end of this file for the bitmap.
+ * pre-rendered as 1-bpp bitmaps. See the big array at the end of this file for
+ * the bitmap.
  */
 
 #include <errno.h>
@@ -54,15 +55,23 @@
 #define LOG_SUBSYSTEM "font_8x16"
 
 /* forward declaration; see end of file for real array */
-static const struct kmscon_glyph kmscon_font_8x16_glyphs[256];
+static struct kmscon_glyph kmscon_font_8x16_glyphs[256];
+static bool kmscon_font_8x16_ink;
 
 static int kmscon_font_8x16_init(struct kmscon_font *out,
 				 const struct kmscon_font_attr *attr)
 {
 	static const char name[] = "static-8x16";
+	unsigned int i;
 
 	log_debug("loading static 8x16 font");
 
+	if (!kmscon_font_8x16_ink) {
+		for (i = 0; i < 256; ++i)
+			kmscon_glyph_set_ink(&kmscon_font_8x16_glyphs[i]);
+		kmscon_font_8x16_ink = true;
+	}
+
 	memset(&out->attr, 0, sizeof(out->attr));
 	memcpy(out->attr.name, name, sizeof(name));
 	out->attr.bold = false;
@@ -115,47 +124,17 @@ struct kmscon_font_ops kmscon_font_8x16_ops = {
 	.render_inval = kmscon_font_8x16_render_inval,
 };
 
-static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
+static struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 	{ /* 0 0x00 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -164,41 +143,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7e, 0x81, 0xa5, 0x81, 0x81, 0xbd,
+				0x99, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -207,41 +156,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7e, 0xff, 0xdb, 0xff, 0xff, 0xc3,
+				0xe7, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -250,41 +169,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x6c, 0xfe, 0xfe, 0xfe,
+				0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -293,41 +182,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe,
+				0x7c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -336,41 +195,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0xe7, 0xe7,
+				0xe7, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -379,41 +208,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0xff, 0xff,
+				0x7e, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -422,41 +221,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c,
+				0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -465,41 +234,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3,
+				0xc3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
 			},
 		},
 	},
@@ -508,41 +247,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x42,
+				0x42, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -551,41 +260,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x99, 0xbd,
+				0xbd, 0x99, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
 			},
 		},
 	},
@@ -594,41 +273,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x1e, 0x0e, 0x1a, 0x32, 0x78, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -637,41 +286,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c,
+				0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -680,41 +299,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3f, 0x33, 0x3f, 0x30, 0x30, 0x30,
+				0x30, 0x70, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -723,41 +312,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7f, 0x63, 0x7f, 0x63, 0x63, 0x63,
+				0x63, 0x67, 0xe7, 0xe6, 0xc0, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -766,41 +325,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x18, 0x18, 0xdb, 0x3c, 0xe7,
+				0x3c, 0xdb, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -809,41 +338,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfe, 0xf8,
+				0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -852,41 +351,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x02, 0x06, 0x0e, 0x1e, 0x3e, 0xfe, 0x3e,
+				0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -895,41 +364,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18,
+				0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -938,41 +377,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+				0x66, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -981,41 +390,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b,
+				0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1024,41 +403,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6,
+				0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1067,41 +416,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1110,41 +429,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18,
+				0x7e, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1153,41 +442,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1196,41 +455,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+				0x18, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1239,41 +468,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0xfe,
+				0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1282,41 +481,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0xfe,
+				0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1325,41 +494,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+				0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1368,41 +507,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x6c, 0xfe,
+				0x6c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1411,41 +520,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x7c,
+				0x7c, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1454,41 +533,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x7c, 0x7c,
+				0x38, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1497,41 +546,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1540,41 +559,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x18,
+				0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1583,41 +572,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x66, 0x66, 0x66, 0x24, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1626,41 +585,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x6c, 0x6c, 0xfe, 0x6c, 0x6c,
+				0x6c, 0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1669,41 +598,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x7c, 0xc6, 0xc2, 0xc0, 0x7c, 0x06,
+				0x06, 0x86, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00,
 			},
 		},
 	},
@@ -1712,41 +611,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0xc2, 0xc6, 0x0c, 0x18,
+				0x30, 0x60, 0xc6, 0x86, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1755,41 +624,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x76, 0xdc,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1798,41 +637,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x30, 0x30, 0x30, 0x60, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1841,41 +650,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1884,41 +663,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x0c,
+				0x0c, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1927,41 +676,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x3c, 0xff,
+				0x3c, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1970,41 +689,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e,
+				0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2013,41 +702,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2056,41 +715,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2099,41 +728,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2142,41 +741,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0c, 0x18,
+				0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2185,41 +754,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xd6, 0xd6,
+				0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2228,41 +767,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x38, 0x78, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2271,41 +780,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7c, 0xc6, 0x06, 0x0c, 0x18, 0x30,
+				0x60, 0xc0, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2314,41 +793,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3c, 0x06,
+				0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2357,41 +806,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x0c, 0x1c, 0x3c, 0x6c, 0xcc, 0xfe,
+				0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2400,41 +819,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xfc, 0x06,
+				0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2443,41 +832,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x38, 0x60, 0xc0, 0xc0, 0xfc, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2486,41 +845,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfe, 0xc6, 0x06, 0x06, 0x0c, 0x18,
+				0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2529,41 +858,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2572,41 +871,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7e, 0x06,
+				0x06, 0x06, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2615,41 +884,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+				0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2658,41 +897,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+				0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2701,41 +910,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60,
+				0x30, 0x18, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2744,41 +923,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+				0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2787,41 +936,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x06,
+				0x0c, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2830,41 +949,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x0c, 0x18, 0x18,
+				0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2873,41 +962,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xde, 0xde,
+				0xde, 0xdc, 0xc0, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2916,41 +975,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe,
+				0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2959,41 +988,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66,
+				0x66, 0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3002,41 +1001,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0,
+				0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3045,41 +1014,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x66,
+				0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3088,41 +1027,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68,
+				0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3131,41 +1040,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68,
+				0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3174,41 +1053,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde,
+				0xc6, 0xc6, 0x66, 0x3a, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3217,41 +1066,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3260,41 +1079,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3303,41 +1092,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+				0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3346,41 +1105,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x78, 0x78,
+				0x6c, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3389,41 +1118,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60,
+				0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3432,41 +1131,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3475,41 +1144,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce,
+				0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3518,41 +1157,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3561,41 +1170,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60,
+				0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3604,41 +1183,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xd6, 0xde, 0x7c, 0x0c, 0x0e, 0x00, 0x00,
 			},
 		},
 	},
@@ -3647,41 +1196,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c,
+				0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3690,41 +1209,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c,
+				0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3733,41 +1222,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3776,41 +1235,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3819,41 +1248,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0x6c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3862,41 +1261,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6,
+				0xd6, 0xfe, 0xee, 0x6c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3905,41 +1274,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38,
+				0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3948,41 +1287,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -3991,41 +1300,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30,
+				0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4034,41 +1313,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4077,41 +1326,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x38,
+				0x1c, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4120,41 +1339,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+				0x0c, 0x0c, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4163,41 +1352,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4206,41 +1365,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
 			},
 		},
 	},
@@ -4249,41 +1378,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4292,41 +1391,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4335,41 +1404,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xe0, 0x60, 0x60, 0x78, 0x6c, 0x66,
+				0x66, 0x66, 0x66, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4378,41 +1417,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0,
+				0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4421,41 +1430,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4464,41 +1443,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4507,41 +1456,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x1c, 0x36, 0x32, 0x30, 0x78, 0x30,
+				0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4550,41 +1469,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00,
 			},
 		},
 	},
@@ -4593,41 +1482,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xe0, 0x60, 0x60, 0x6c, 0x76, 0x66,
+				0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4636,41 +1495,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4679,41 +1508,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x06, 0x06, 0x00, 0x0e, 0x06, 0x06,
+				0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x3c, 0x00,
 			},
 		},
 	},
@@ -4722,41 +1521,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xe0, 0x60, 0x60, 0x66, 0x6c, 0x78,
+				0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4765,41 +1534,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4808,41 +1547,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6,
+				0xd6, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4851,41 +1560,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4894,41 +1573,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -4937,41 +1586,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00,
 			},
 		},
 	},
@@ -4980,41 +1599,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0x0c, 0x1e, 0x00,
 			},
 		},
 	},
@@ -5023,41 +1612,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x66,
+				0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5066,41 +1625,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60,
+				0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5109,41 +1638,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30,
+				0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5152,41 +1651,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5195,41 +1664,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5238,41 +1677,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xd6,
+				0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5281,41 +1690,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38,
+				0x38, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5324,41 +1703,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00,
 			},
 		},
 	},
@@ -5367,41 +1716,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xcc, 0x18,
+				0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5410,41 +1729,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x0e, 0x18, 0x18, 0x18, 0x70, 0x18,
+				0x18, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5453,41 +1742,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5496,41 +1755,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x70, 0x18, 0x18, 0x18, 0x0e, 0x18,
+				0x18, 0x18, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5539,41 +1768,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5582,41 +1781,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6,
+				0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5625,41 +1794,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0,
+				0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00,
 			},
 		},
 	},
@@ -5668,41 +1807,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5711,41 +1820,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5754,41 +1833,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5797,41 +1846,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5840,41 +1859,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5883,41 +1872,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -5926,41 +1885,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0,
+				0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x70, 0x00, 0x00,
 			},
 		},
 	},
@@ -5969,41 +1898,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6012,41 +1911,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6055,41 +1924,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6098,41 +1937,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6141,41 +1950,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6184,41 +1963,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6227,41 +1976,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6,
+				0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6270,41 +1989,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xfe,
+				0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6313,41 +2002,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78,
+				0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6356,41 +2015,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36,
+				0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6399,41 +2028,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc,
+				0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6442,41 +2041,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6485,41 +2054,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0x00, 0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6528,41 +2067,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6571,41 +2080,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6614,41 +2093,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6657,41 +2106,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00,
 			},
 		},
 	},
@@ -6700,41 +2119,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6743,41 +2132,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6786,41 +2145,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0, 0xc0, 0xc0,
+				0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6829,41 +2158,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60,
+				0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6872,41 +2171,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18,
+				0x7e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6915,41 +2184,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde,
+				0xcc, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -6958,41 +2197,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18,
+				0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7001,41 +2210,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7044,41 +2223,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7087,41 +2236,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7130,41 +2249,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7173,41 +2262,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7216,41 +2275,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde,
+				0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7259,41 +2288,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7302,41 +2301,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7345,41 +2314,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60,
+				0xc0, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7388,41 +2327,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0,
+				0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7431,41 +2340,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06,
+				0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7474,41 +2353,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30,
+				0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00,
 			},
 		},
 	},
@@ -7517,41 +2366,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30,
+				0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00,
 			},
 		},
 	},
@@ -7560,41 +2379,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18,
+				0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7603,41 +2392,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6c, 0xd8,
+				0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7646,41 +2405,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6c, 0x36,
+				0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -7689,41 +2418,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
+				0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
 			},
 		},
 	},
@@ -7732,41 +2431,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
+				0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
 			},
 		},
 	},
@@ -7775,41 +2444,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77,
+				0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77,
 			},
 		},
 	},
@@ -7818,41 +2457,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -7861,41 +2470,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -7904,41 +2483,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -7947,41 +2496,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -7990,41 +2509,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8033,41 +2522,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -8076,41 +2535,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8119,41 +2548,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8162,41 +2561,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8205,41 +2574,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8248,41 +2587,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8291,41 +2600,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8334,41 +2613,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -8377,41 +2626,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8420,41 +2639,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8463,41 +2652,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -8506,41 +2665,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -8549,41 +2678,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8592,41 +2691,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -8635,41 +2704,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -8678,41 +2717,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8721,41 +2730,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8764,41 +2743,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8807,41 +2756,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8850,41 +2769,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8893,41 +2782,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8936,41 +2795,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -8979,41 +2808,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -9022,41 +2821,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9065,41 +2834,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9108,41 +2847,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -9151,41 +2860,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -9194,41 +2873,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9237,41 +2886,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9280,41 +2899,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -9323,41 +2912,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -9366,41 +2925,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -9409,41 +2938,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -9452,41 +2951,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9495,41 +2964,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -9538,41 +2977,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
 			},
 		},
 	},
@@ -9581,41 +2990,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
 			},
 		},
 	},
@@ -9624,41 +3003,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+				0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
 			},
 		},
 	},
@@ -9667,41 +3016,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+				0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
 			},
 		},
 	},
@@ -9710,41 +3029,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9753,41 +3042,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8,
+				0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9796,41 +3055,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc,
+				0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9839,41 +3068,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0,
+				0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9882,41 +3081,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6c, 0x6c,
+				0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9925,41 +3094,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x18,
+				0x30, 0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -9968,41 +3107,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8,
+				0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10011,41 +3120,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x00,
 			},
 		},
 	},
@@ -10054,41 +3133,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10097,41 +3146,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66,
+				0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10140,41 +3159,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6,
+				0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10183,41 +3172,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c,
+				0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10226,41 +3185,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66,
+				0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10269,41 +3198,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb,
+				0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10312,41 +3211,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x03, 0x06, 0x7e, 0xdb, 0xdb,
+				0xf3, 0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10355,41 +3224,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60,
+				0x60, 0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10398,41 +3237,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10441,41 +3250,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+				0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10484,41 +3263,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18,
+				0x18, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10527,41 +3276,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c,
+				0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10570,41 +3289,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30,
+				0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10613,41 +3302,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -10656,41 +3315,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+				0x18, 0xd8, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10699,41 +3328,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7e,
+				0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10742,41 +3341,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00,
+				0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10785,41 +3354,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10828,41 +3367,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+				0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10871,41 +3380,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10914,41 +3393,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec,
+				0x6c, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10957,41 +3406,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x6c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -11000,41 +3419,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x3c, 0x66, 0x0c, 0x18, 0x32, 0x7e, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -11043,41 +3432,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7e,
+				0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -11086,41 +3445,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
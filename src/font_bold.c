@@ -0,0 +1,439 @@
+/*
+ * kmscon - Synthetic Bold Fonts
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * SECTION:font_bold.c
+ * @short_description: Synthetic bold fonts
+ * @include: font.h
+ *
+ * Instead of loading a separate bold face, kmscon_font_new_bold() derives bold
+ * glyphs from the glyphs of an existing font by dilating them one pixel to
+ * the right. This makes creating the bold font (on startup and on every zoom)
+ * almost free; glyphs are derived lazily on first use and kept in a bounded
+ * cache like the glyphs of the backends.
+ *
+ * The derived font forwards everything else to the regular font. Procedural
+ * box-drawing glyphs are passed through unmodified so lines of bold and
+ * regular cells still connect.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "font.h"
+#include "shl_log.h"
+#include "shl_lru.h"
+#include "shl_misc.h"
+#include "shl_u32map.h"
+#include "uterm_video.h"
+
+#define LOG_SUBSYSTEM "font_bold"
+
+struct bold_glyph {
+	struct shl_lru_entry lru;
+	uint32_t id;
+	struct kmscon_glyph glyph;
+	uint8_t data[];
+};
+
+SHL_U32MAP_DEFINE(bold_map, struct bold_glyph)
+
+struct bold_font {
+	struct kmscon_font *base;
+
+	pthread_mutex_t lock;
+	struct bold_map glyphs;
+	struct shl_lru lru;
+	struct bold_glyph **fast;
+};
+
+/*
+ * Dilation
+ * Every pixel is combined with its left neighbour. 8-bit rows are processed 16
+ * pixels at a time with GCC vector extensions, which map to SSE2 or NEON where
+ * available, and 1-bpp rows 8 pixels at a time by shifting whole bytes. The
+ * rightmost column is lost, as bold glyphs of real bold faces are clipped to
+ * the cell, too.
+ */
+
+typedef uint8_t bold_vec __attribute__((vector_size(16)));
+
+static void dilate_grey(uint8_t *restrict dst, const uint8_t *restrict src,
+			unsigned int width)
+{
+	bold_vec a, b, m;
+	unsigned int i;
+
+	if (!width)
+		return;
+
+	dst[0] = src[0];
+	for (i = 1; i + sizeof(a) <= width; i += sizeof(a)) {
+		memcpy(&a, &src[i], sizeof(a));
+		memcpy(&b, &src[i - 1], sizeof(b));
+		m = (bold_vec)(a > b);
+		a = (a & m) | (b & ~m);
+		memcpy(&dst[i], &a, sizeof(a));
+	}
+	for ( ; i < width; ++i)
+		dst[i] = src[i] > src[i - 1] ? src[i] : src[i - 1];
+}
+
+static void dilate_mono(uint8_t *restrict dst, const uint8_t *restrict src,
+			unsigned int width)
+{
+	unsigned int i, num = (width + 7) / 8;
+	uint8_t carry = 0;
+
+	for (i = 0; i < num; ++i) {
+		dst[i] = src[i] | (src[i] >> 1) | carry;
+		carry = src[i] << 7;
+	}
+
+	/* clear the padding bits the last pixel was shifted into */
+	if (width % 8)
+		dst[num - 1] &= 0xff << (8 - width % 8);
+}
+
+static struct bold_glyph *new_bold_glyph(uint32_t id,
+					 const struct kmscon_glyph *src)
+{
+	const struct uterm_video_buffer *buf = &src->buf;
+	struct bold_glyph *bg;
+	unsigned int i;
+	size_t size;
+
+	size = (size_t)buf->stride * buf->height;
+	bg = malloc(sizeof(*bg) + size);
+	if (!bg)
+		return NULL;
+
+	memset(bg, 0, sizeof(*bg));
+	bg->id = id;
+	bg->glyph.width = src->width;
+	bg->glyph.buf = *buf;
+	bg->glyph.buf.data = bg->data;
+
+	for (i = 0; i < buf->height; ++i) {
+		if (buf->format == UTERM_FORMAT_MONO)
+			dilate_mono(&bg->data[i * buf->stride],
+				    &buf->data[i * buf->stride], buf->width);
+		else
+			dilate_grey(&bg->data[i * buf->stride],
+				    &buf->data[i * buf->stride], buf->width);
+	}
+
+	kmscon_glyph_set_ink(&bg->glyph);
+	return bg;
+}
+
+static size_t bold_glyph_size(const struct bold_glyph *bg)
+{
+	return sizeof(*bg) + bg->glyph.buf.stride * bg->glyph.buf.height;
+}
+
+static void free_bold_glyph(struct bold_glyph *bg)
+{
+	free(bg);
+}
+
+/* Must be called with bf->lock held. */
+static void bold__evict(struct bold_font *bf)
+{
+	struct shl_lru_entry *e;
+	struct bold_glyph *bg;
+	unsigned long epoch;
+
+	bf->lru.limit = kmscon_font_get_cache_limit();
+	epoch = kmscon_font_get_epoch();
+
+	while ((e = shl_lru_victim(&bf->lru, epoch))) {
+		bg = shl_offsetof(e, struct bold_glyph, lru);
+		shl_lru_evict(&bf->lru, e);
+		if (bg->id < KMSCON_GLYPH_FAST_NUM)
+			__atomic_store_n(&bf->fast[bg->id], NULL,
+					 __ATOMIC_RELEASE);
+		bold_map_remove(&bf->glyphs, bg->id);
+		free_bold_glyph(bg);
+	}
+}
+
+/* Returns the cached bold glyph for @id, if there is one in the fast array. */
+static struct bold_glyph *bold_find_fast(struct bold_font *bf, uint32_t id)
+{
+	struct bold_glyph *bg;
+
+	if (id >= KMSCON_GLYPH_FAST_NUM)
+		return NULL;
+
+	bg = __atomic_load_n(&bf->fast[id], __ATOMIC_ACQUIRE);
+	if (bg)
+		shl_lru_mark(&bf->lru, &bg->lru, kmscon_font_get_epoch());
+	return bg;
+}
+
+/* Derive the bold version of @glyph, the regular glyph of @id. */
+static int bold_derive(struct bold_font *bf, uint32_t id, const uint32_t *ch,
+		       size_t len, const struct kmscon_glyph *glyph,
+		       const struct kmscon_glyph **out)
+{
+	struct bold_glyph *bg;
+	int ret = 0;
+
+	if ((len == 1 && kmscon_font_box_covers(*ch)) ||
+	    (glyph->buf.format != UTERM_FORMAT_GREY &&
+	     glyph->buf.format != UTERM_FORMAT_MONO)) {
+		*out = glyph;
+		return 0;
+	}
+
+	pthread_mutex_lock(&bf->lock);
+
+	bg = bold_map_find(&bf->glyphs, id);
+	if (bg) {
+		shl_lru_touch(&bf->lru, &bg->lru, kmscon_font_get_epoch());
+		goto out_unlock;
+	}
+
+	bg = new_bold_glyph(id, glyph);
+	if (!bg) {
+		ret = -ENOMEM;
+		goto out_unlock;
+	}
+
+	ret = bold_map_insert(&bf->glyphs, id, bg);
+	if (ret) {
+		log_error("cannot add bold glyph to glyph table");
+		free_bold_glyph(bg);
+		goto out_unlock;
+	}
+
+	shl_lru_add(&bf->lru, &bg->lru, bold_glyph_size(bg),
+		    kmscon_font_get_epoch());
+	if (id < KMSCON_GLYPH_FAST_NUM)
+		__atomic_store_n(&bf->fast[id], bg, __ATOMIC_RELEASE);
+	bold__evict(bf);
+
+out_unlock:
+	pthread_mutex_unlock(&bf->lock);
+	if (!ret)
+		*out = &bg->glyph;
+	return ret;
+}
+
+static int bold_render(struct kmscon_font *font,
+		       uint32_t id, const uint32_t *ch, size_t len,
+		       const struct kmscon_glyph **out)
+{
+	struct bold_font *bf = font->data;
+	const struct kmscon_glyph *glyph;
+	struct bold_glyph *bg;
+	int ret;
+
+	bg = bold_find_fast(bf, id);
+	if (bg) {
+		*out = &bg->glyph;
+		return 0;
+	}
+
+	ret = kmscon_font_render(bf->base, id, ch, len, &glyph);
+	if (ret)
+		return ret;
+
+	return bold_derive(bf, id, ch, len, glyph, out);
+}
+
+/* deriving is cheap, so only the regular glyph must be ready */
+static int bold_lookup(struct kmscon_font *font,
+		       uint32_t id, const uint32_t *ch, size_t len,
+		       const struct kmscon_glyph **out)
+{
+	struct bold_font *bf = font->data;
+	const struct kmscon_glyph *glyph;
+	struct bold_glyph *bg;
+	int ret;
+
+	bg = bold_find_fast(bf, id);
+	if (bg) {
+		*out = &bg->glyph;
+		return 0;
+	}
+
+	ret = kmscon_font_lookup(bf->base, id, ch, len, &glyph);
+	if (ret)
+		return ret;
+
+	return bold_derive(bf, id, ch, len, glyph, out);
+}
+
+static int bold_render_empty(struct kmscon_font *font,
+			     const struct kmscon_glyph **out)
+{
+	struct bold_font *bf = font->data;
+
+	return kmscon_font_render_empty(bf->base, out);
+}
+
+static int bold_render_inval(struct kmscon_font *font,
+			     const struct kmscon_glyph **out)
+{
+	struct bold_font *bf = font->data;
+
+	return kmscon_font_render_inval(bf->base, out);
+}
+
+/* prefetching the regular glyphs is all a batch can do for us */
+static int bold_render_batch(struct kmscon_font *font,
+			     const struct kmscon_font_req *reqs, size_t num)
+{
+	struct bold_font *bf = font->data;
+
+	return kmscon_font_render_batch(bf->base, reqs, num);
+}
+
+static void bold_get_stats(struct kmscon_font *font,
+			   struct kmscon_glyph_stats *stats)
+{
+	struct bold_font *bf = font->data;
+
+	pthread_mutex_lock(&bf->lock);
+	stats->size = bf->lru.size;
+	stats->limit = bf->lru.limit;
+	stats->entries = bf->lru.entries;
+	stats->hits = shl_lru_get_hits(&bf->lru);
+	stats->misses = bf->lru.misses;
+	stats->evictions = bf->lru.evictions;
+	pthread_mutex_unlock(&bf->lock);
+}
+
+static void bold_destroy(struct kmscon_font *font)
+{
+	struct bold_font *bf = font->data;
+
+	log_debug("freeing synthetic bold font (%lu glyphs, %zu bytes)",
+		  bf->lru.entries, bf->lru.size);
+
+	bold_map_clear(&bf->glyphs, free_bold_glyph);
+	free(bf->fast);
+	pthread_mutex_destroy(&bf->lock);
+	kmscon_font_unref(bf->base);
+	free(bf);
+}
+
+/* only advertise batches if the regular font supports them, the text layer
+ * defers drawing for fonts with batch support */
+static const struct kmscon_font_ops bold_ops = {
+	.name = "synthetic-bold",
+	.owner = NULL,
+	.destroy = bold_destroy,
+	.render = bold_render,
+	.lookup = bold_lookup,
+	.render_empty = bold_render_empty,
+	.render_inval = bold_render_inval,
+	.get_stats = bold_get_stats,
+};
+
+static const struct kmscon_font_ops bold_batch_ops = {
+	.name = "synthetic-bold",
+	.owner = NULL,
+	.destroy = bold_destroy,
+	.render = bold_render,
+	.lookup = bold_lookup,
+	.render_empty = bold_render_empty,
+	.render_inval = bold_render_inval,
+	.render_batch = bold_render_batch,
+	.get_stats = bold_get_stats,
+};
+
+/**
+ * kmscon_font_new_bold:
+ * @out: A pointer to the new font is stored here
+ * @font: Regular font to derive the bold font from
+ *
+ * This creates a font with the same metrics as @font that renders the glyphs
+ * of @font emboldened. The new font takes a reference to @font.
+ *
+ * Returns: 0 on success, negative error code on failure
+ */
+int kmscon_font_new_bold(struct kmscon_font **out, struct kmscon_font *font)
+{
+	struct kmscon_font *bold;
+	struct bold_font *bf;
+	int ret;
+
+	if (!out || !font)
+		return -EINVAL;
+
+	bold = malloc(sizeof(*bold));
+	if (!bold)
+		return -ENOMEM;
+	memset(bold, 0, sizeof(*bold));
+
+	bf = malloc(sizeof(*bf));
+	if (!bf) {
+		ret = -ENOMEM;
+		goto err_bold;
+	}
+	memset(bf, 0, sizeof(*bf));
+	bold_map_init(&bf->glyphs);
+	shl_lru_init(&bf->lru, kmscon_font_get_cache_limit());
+
+	bf->fast = calloc(KMSCON_GLYPH_FAST_NUM, sizeof(*bf->fast));
+	if (!bf->fast) {
+		ret = -ENOMEM;
+		goto err_bf;
+	}
+
+	ret = pthread_mutex_init(&bf->lock, NULL);
+	if (ret) {
+		ret = -ret;
+		goto err_fast;
+	}
+
+	bf->base = font;
+	kmscon_font_ref(font);
+
+	bold->ref = 1;
+	bold->ops = font->ops->render_batch ? &bold_batch_ops : &bold_ops;
+	bold->attr = font->attr;
+	bold->attr.bold = true;
+	bold->baseline = font->baseline;
+	bold->data = bf;
+
+	log_debug("using synthetic bold for %s font", font->ops->name);
+	*out = bold;
+	return 0;
+
+err_fast:
+	free(bf->fast);
+err_bf:
+	free(bf);
+err_bold:
+	free(bold);
+	return ret;
+}
@@ -0,0 +1,699 @@
+/*
+ * kmscon - Procedural Box-Drawing Glyphs
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * SECTION:font_box.c
+ * @short_description: Procedural box-drawing, block and braille glyphs
+ * @include: font.h
+ *
+ * Box-drawing characters (U+2500-U+257F), block elements (U+2580-U+259F) and
+ * braille patterns (U+2800-U+28FF) are drawn by TUI applications all over the
+ * screen. Fonts often do not cover them, so they end up in expensive fallback
+ * searches, and if they do, lines rarely line up with the neighbouring cells.
+ *
+ * kmscon_font_render() therefore serves these ranges from here for all
+ * backends. The glyphs are rasterized procedurally for the cell size of the
+ * font, so lines always meet at the same offsets on all cell edges. Glyphs
+ * are rendered on first use and stay cached until the font is destroyed.
+ * Lookups are lock-free, rendering is serialized by a mutex.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "font.h"
+#include "shl_log.h"
+#include "uterm_video.h"
+
+#define LOG_SUBSYSTEM "font_box"
+
+#define BOX_LINES_START 0x2500
+#define BOX_BLOCKS_START 0x2580
+#define BOX_BLOCKS_END 0x25a0
+#define BOX_BRAILLE_START 0x2800
+#define BOX_BRAILLE_END 0x2900
+
+#define BOX_NUM ((BOX_BLOCKS_END - BOX_LINES_START) + \
+		 (BOX_BRAILLE_END - BOX_BRAILLE_START))
+
+/* number of sub-samples per axis for anti-aliased arcs and diagonals */
+#define BOX_SAMPLES 4
+
+struct kmscon_font_box {
+	pthread_mutex_t lock;
+	unsigned int width;
+	unsigned int height;
+	unsigned int light;
+	unsigned int heavy;
+	struct kmscon_glyph *glyphs[BOX_NUM];
+};
+
+/*
+ * Line styles of the four arms of box-drawing characters. Each entry has two
+ * bits per arm: up, right, down and left, starting at the least significant
+ * bit. Dashed lines, arcs and diagonals are drawn separately.
+ */
+
+enum box_style {
+	BOX_NONE,
+	BOX_LIGHT,
+	BOX_HEAVY,
+	BOX_DOUBLE,
+};
+
+/* shorthands for the table below */
+#define N BOX_NONE
+#define L BOX_LIGHT
+#define H BOX_HEAVY
+#define D BOX_DOUBLE
+#define B(_u, _r, _d, _l) ((_u) | ((_r) << 2) | ((_d) << 4) | ((_l) << 6))
+
+static const uint8_t box_arms[BOX_BLOCKS_START - BOX_LINES_START] = {
+	/* U+2500 */
+	B(N, L, N, L), B(N, H, N, H), B(L, N, L, N), B(H, N, H, N),
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	B(N, L, L, N), B(N, H, L, N), B(N, L, H, N), B(N, H, H, N),
+	/* U+2510 */
+	B(N, N, L, L), B(N, N, L, H), B(N, N, H, L), B(N, N, H, H),
+	B(L, L, N, N), B(L, H, N, N), B(H, L, N, N), B(H, H, N, N),
+	B(L, N, N, L), B(L, N, N, H), B(H, N, N, L), B(H, N, N, H),
+	B(L, L, L, N), B(L, H, L, N), B(H, L, L, N), B(L, L, H, N),
+	/* U+2520 */
+	B(H, L, H, N), B(H, H, L, N), B(L, H, H, N), B(H, H, H, N),
+	B(L, N, L, L), B(L, N, L, H), B(H, N, L, L), B(L, N, H, L),
+	B(H, N, H, L), B(H, N, L, H), B(L, N, H, H), B(H, N, H, H),
+	B(N, L, L, L), B(N, L, L, H), B(N, H, L, L), B(N, H, L, H),
+	/* U+2530 */
+	B(N, L, H, L), B(N, L, H, H), B(N, H, H, L), B(N, H, H, H),
+	B(L, L, N, L), B(L, L, N, H), B(L, H, N, L), B(L, H, N, H),
+	B(H, L, N, L), B(H, L, N, H), B(H, H, N, L), B(H, H, N, H),
+	B(L, L, L, L), B(L, L, L, H), B(L, H, L, L), B(L, H, L, H),
+	/* U+2540 */
+	B(H, L, L, L), B(L, L, H, L), B(H, L, H, L), B(H, L, L, H),
+	B(H, H, L, L), B(L, L, H, H), B(L, H, H, L), B(H, H, L, H),
+	B(L, H, H, H), B(H, L, H, H), B(H, H, H, L), B(H, H, H, H),
+	0, 0, 0, 0,
+	/* U+2550 */
+	B(N, D, N, D), B(D, N, D, N), B(N, D, L, N), B(N, L, D, N),
+	B(N, D, D, N), B(N, N, L, D), B(N, N, D, L), B(N, N, D, D),
+	B(L, D, N, N), B(D, L, N, N), B(D, D, N, N), B(L, N, N, D),
+	B(D, N, N, L), B(D, N, N, D), B(L, D, L, N), B(D, L, D, N),
+	/* U+2560 */
+	B(D, D, D, N), B(L, N, L, D), B(D, N, D, L), B(D, N, D, D),
+	B(N, D, L, D), B(N, L, D, L), B(N, D, D, D), B(L, D, N, D),
+	B(D, L, N, L), B(D, D, N, D), B(L, D, L, D), B(D, L, D, L),
+	B(D, D, D, D), 0, 0, 0,
+	/* U+2570 */
+	0, 0, 0, 0,
+	B(N, N, N, L), B(L, N, N, N), B(N, L, N, N), B(N, N, L, N),
+	B(N, N, N, H), B(H, N, N, N), B(N, H, N, N), B(N, N, H, N),
+	B(N, H, N, L), B(L, N, H, N), B(N, L, N, H), B(H, N, L, N),
+};
+
+#undef B
+#undef D
+#undef H
+#undef L
+#undef N
+
+struct box_canvas {
+	uint8_t *data;
+	int width;
+	int height;
+};
+
+static void box_fill(struct box_canvas *c, int x, int y, int width,
+		     int height, uint8_t val)
+{
+	int i;
+
+	if (x < 0) {
+		width += x;
+		x = 0;
+	}
+	if (y < 0) {
+		height += y;
+		y = 0;
+	}
+	if (x + width > c->width)
+		width = c->width - x;
+	if (y + height > c->height)
+		height = c->height - y;
+	if (width <= 0 || height <= 0)
+		return;
+
+	for (i = 0; i < height; ++i)
+		memset(&c->data[(y + i) * c->width + x], val, width);
+}
+
+static void box_fill_range(struct box_canvas *c, int x0, int y0, int x1,
+			   int y1)
+{
+	box_fill(c, x0, y0, x1 - x0, y1 - y0, 0xff);
+}
+
+/* offset of a line of thickness @t centered in @size pixels */
+static int box_pos(int size, int t)
+{
+	return (size - t) / 2;
+}
+
+static int box_thickness(const struct kmscon_font_box *box, unsigned int s)
+{
+	switch (s) {
+	case BOX_LIGHT:
+		return box->light;
+	case BOX_HEAVY:
+		return box->heavy;
+	case BOX_DOUBLE:
+		return box->light * 3;
+	default:
+		return 0;
+	}
+}
+
+/* width of a single line of style @s, double lines consist of light lines */
+static int box_line_width(const struct kmscon_font_box *box, unsigned int s)
+{
+	return box_thickness(box, s == BOX_DOUBLE ? BOX_LIGHT : s);
+}
+
+/*
+ * Each arm runs from its cell edge to the center and overlaps the lines of the
+ * perpendicular arms so corners and junctions are closed. Double lines are two
+ * light lines with a light gap in between. Where two double arms meet, each of
+ * the two lines stops at the corner it forms with the nearest line of the
+ * other arm, so the inner and outer lines of corners and junctions connect.
+ */
+static void box_draw_arms(const struct kmscon_font_box *box,
+			  struct box_canvas *c, uint8_t arms)
+{
+	int w = c->width, h = c->height, t = box->light, s;
+	unsigned int u, r, d, l;
+	int tv, th, x1, x2, y1, y2, hend, hstart, vend, vstart, a, b;
+
+	u = arms & 3;
+	r = (arms >> 2) & 3;
+	d = (arms >> 4) & 3;
+	l = (arms >> 6) & 3;
+
+	/* widths of the vertical and horizontal line */
+	tv = box_thickness(box, u);
+	if (box_thickness(box, d) > tv)
+		tv = box_thickness(box, d);
+	th = box_thickness(box, l);
+	if (box_thickness(box, r) > th)
+		th = box_thickness(box, r);
+
+	/* positions of the two lines of double lines */
+	x1 = box_pos(w, 3 * t);
+	x2 = x1 + 2 * t;
+	y1 = box_pos(h, 3 * t);
+	y2 = y1 + 2 * t;
+
+	if (l) {
+		s = tv ? tv : box_line_width(box, l);
+		hend = box_pos(w, s) + s;
+		if (l == BOX_DOUBLE) {
+			a = u == BOX_DOUBLE ? x1 + t :
+			    d == BOX_DOUBLE ? x2 + t : hend;
+			b = d == BOX_DOUBLE ? x1 + t :
+			    u == BOX_DOUBLE ? x2 + t : hend;
+			box_fill_range(c, 0, y1, a, y1 + t);
+			box_fill_range(c, 0, y2, b, y2 + t);
+		} else {
+			if (u == BOX_DOUBLE && d == BOX_DOUBLE && !r)
+				hend = x1 + t;
+			s = box_thickness(box, l);
+			box_fill(c, 0, box_pos(h, s), hend, s, 0xff);
+		}
+	}
+
+	if (r) {
+		s = tv ? tv : box_line_width(box, r);
+		hstart = box_pos(w, s);
+		if (r == BOX_DOUBLE) {
+			a = u == BOX_DOUBLE ? x2 :
+			    d == BOX_DOUBLE ? x1 : hstart;
+			b = d == BOX_DOUBLE ? x2 :
+			    u == BOX_DOUBLE ? x1 : hstart;
+			box_fill_range(c, a, y1, w, y1 + t);
+			box_fill_range(c, b, y2, w, y2 + t);
+		} else {
+			if (u == BOX_DOUBLE && d == BOX_DOUBLE && !l)
+				hstart = x2;
+			s = box_thickness(box, r);
+			box_fill_range(c, hstart, box_pos(h, s), w,
+				       box_pos(h, s) + s);
+		}
+	}
+
+	if (u) {
+		s = th ? th : box_line_width(box, u);
+		vend = box_pos(h, s) + s;
+		if (u == BOX_DOUBLE) {
+			a = l == BOX_DOUBLE ? y1 + t :
+			    r == BOX_DOUBLE ? y2 + t : vend;
+			b = r == BOX_DOUBLE ? y1 + t :
+			    l == BOX_DOUBLE ? y2 + t : vend;
+			box_fill_range(c, x1, 0, x1 + t, a);
+			box_fill_range(c, x2, 0, x2 + t, b);
+		} else {
+			if (l == BOX_DOUBLE && r == BOX_DOUBLE && !d)
+				vend = y1 + t;
+			s = box_thickness(box, u);
+			box_fill(c, box_pos(w, s), 0, s, vend, 0xff);
+		}
+	}
+
+	if (d) {
+		s = th ? th : box_line_width(box, d);
+		vstart = box_pos(h, s);
+		if (d == BOX_DOUBLE) {
+			a = l == BOX_DOUBLE ? y2 :
+			    r == BOX_DOUBLE ? y1 : vstart;
+			b = r == BOX_DOUBLE ? y2 :
+			    l == BOX_DOUBLE ? y1 : vstart;
+			box_fill_range(c, x1, a, x1 + t, h);
+			box_fill_range(c, x2, b, x2 + t, h);
+		} else {
+			if (l == BOX_DOUBLE && r == BOX_DOUBLE && !u)
+				vstart = y2;
+			s = box_thickness(box, d);
+			box_fill_range(c, box_pos(w, s), vstart,
+				       box_pos(w, s) + s, h);
+		}
+	}
+}
+
+/* U+2504-U+250B and U+254C-U+254F; @num dashes with a gap after each one */
+static void box_draw_dashes(const struct kmscon_font_box *box,
+			    struct box_canvas *c, uint32_t ch)
+{
+	unsigned int off, style, num;
+	bool vert;
+	int i, t, size, start, end, gap;
+
+	if (ch >= 0x254c) {
+		off = ch - 0x254c;
+		num = 2;
+	} else {
+		off = ch - 0x2504;
+		num = 3 + off / 4;
+		off %= 4;
+	}
+
+	style = (off & 1) ? BOX_HEAVY : BOX_LIGHT;
+	vert = off & 2;
+	t = box_thickness(box, style);
+	size = vert ? c->height : c->width;
+
+	for (i = 0; i < (int)num; ++i) {
+		start = i * size / (int)num;
+		end = (i + 1) * size / (int)num;
+		gap = (end - start) / 3;
+		if (!gap && end - start > 1)
+			gap = 1;
+		start += gap / 2;
+		end -= gap - gap / 2;
+
+		if (vert)
+			box_fill_range(c, box_pos(c->width, t), start,
+				       box_pos(c->width, t) + t, end);
+		else
+			box_fill_range(c, start, box_pos(c->height, t), end,
+				       box_pos(c->height, t) + t);
+	}
+}
+
+/*
+ * Anti-aliasing helpers. Coordinates are in units of 1 / BOX_SAMPLES pixels
+ * with sample centers at odd half-units, so everything stays integer.
+ */
+
+static void box_set_coverage(struct box_canvas *c, int x, int y,
+			     unsigned int hits)
+{
+	unsigned int val;
+	uint8_t *dst = &c->data[y * c->width + x];
+
+	val = hits * 255 / (BOX_SAMPLES * BOX_SAMPLES);
+	if (val > *dst)
+		*dst = val;
+}
+
+/* U+256D-U+2570; a quarter circle joining the two light arms */
+static void box_draw_arc(const struct kmscon_font_box *box,
+			 struct box_canvas *c, uint32_t ch)
+{
+	static const int dirs[4][2] = {
+		{ 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 },
+	};
+	int t = box->light, sx, sy, lx, ly, rad, cx, cy;
+	int x, y, i, j, px, py, dx, dy;
+	int64_t dist, rin, rout;
+	unsigned int hits;
+
+	sx = dirs[ch - 0x256d][0];
+	sy = dirs[ch - 0x256d][1];
+
+	/* line centers in sub-sample units */
+	lx = (2 * box_pos(c->width, t) + t) * BOX_SAMPLES;
+	ly = (2 * box_pos(c->height, t) + t) * BOX_SAMPLES;
+	dx = sx > 0 ? 2 * c->width * BOX_SAMPLES - lx : lx;
+	dy = sy > 0 ? 2 * c->height * BOX_SAMPLES - ly : ly;
+	rad = dx < dy ? dx : dy;
+	cx = lx + sx * rad;
+	cy = ly + sy * rad;
+
+	rin = (int64_t)(rad - t * BOX_SAMPLES) * (rad - t * BOX_SAMPLES);
+	rout = (int64_t)(rad + t * BOX_SAMPLES) * (rad + t * BOX_SAMPLES);
+	if (rad < t * BOX_SAMPLES)
+		rin = 0;
+
+	for (y = 0; y < c->height; ++y) {
+		for (x = 0; x < c->width; ++x) {
+			hits = 0;
+			for (j = 0; j < BOX_SAMPLES; ++j) {
+				py = (y * BOX_SAMPLES + j) * 2 + 1;
+				if ((py - cy) * sy > 0)
+					continue;
+				for (i = 0; i < BOX_SAMPLES; ++i) {
+					px = (x * BOX_SAMPLES + i) * 2 + 1;
+					if ((px - cx) * sx > 0)
+						continue;
+					dist = (int64_t)(px - cx) * (px - cx) +
+					       (int64_t)(py - cy) * (py - cy);
+					if (dist >= rin && dist <= rout)
+						++hits;
+				}
+			}
+			box_set_coverage(c, x, y, hits);
+		}
+	}
+
+	/* straight remainders from the end of the arc to the cell edges */
+	cx /= 2 * BOX_SAMPLES;
+	cy /= 2 * BOX_SAMPLES;
+	if (sx > 0)
+		box_fill_range(c, cx, box_pos(c->height, t), c->width,
+			       box_pos(c->height, t) + t);
+	else
+		box_fill_range(c, 0, box_pos(c->height, t), cx,
+			       box_pos(c->height, t) + t);
+	if (sy > 0)
+		box_fill_range(c, box_pos(c->width, t), cy,
+			       box_pos(c->width, t) + t, c->height);
+	else
+		box_fill_range(c, box_pos(c->width, t), 0,
+			       box_pos(c->width, t) + t, cy);
+}
+
+/* U+2571-U+2573; light lines between opposite cell corners */
+static void box_draw_diagonals(const struct kmscon_font_box *box,
+			       struct box_canvas *c, uint32_t ch)
+{
+	int64_t w = c->width, h = c->height, t = box->light, px, py, e, lim;
+	int x, y, i, j;
+	unsigned int hits;
+	bool rising, falling;
+
+	rising = ch != 0x2572;
+	falling = ch != 0x2571;
+
+	/* |e| / sqrt(w^2 + h^2) is the distance to the diagonal, compare
+	 * squares against half the line width to avoid floating point */
+	lim = t * t * (w * w + h * h) * BOX_SAMPLES * BOX_SAMPLES;
+
+	for (y = 0; y < c->height; ++y) {
+		for (x = 0; x < c->width; ++x) {
+			hits = 0;
+			for (j = 0; j < BOX_SAMPLES; ++j) {
+				py = (y * BOX_SAMPLES + j) * 2 + 1;
+				for (i = 0; i < BOX_SAMPLES; ++i) {
+					px = (x * BOX_SAMPLES + i) * 2 + 1;
+					if (falling) {
+						e = h * px - w * py;
+						if (e * e <= lim) {
+							++hits;
+							continue;
+						}
+					}
+					if (rising) {
+						e = h * px + w * py -
+						    2 * w * h * BOX_SAMPLES;
+						if (e * e <= lim)
+							++hits;
+					}
+				}
+			}
+			box_set_coverage(c, x, y, hits);
+		}
+	}
+}
+
+/* number of rows/columns covered by @num eighths of @size pixels */
+static int box_eighths(int size, int num)
+{
+	return (size * num + 4) / 8;
+}
+
+/* U+2580-U+259F */
+static void box_draw_block(struct box_canvas *c, uint32_t ch)
+{
+	/* quadrants of U+2596-U+259F: upper left, upper right, lower left,
+	 * lower right */
+	static const uint8_t quads[10] = {
+		0x4, 0x8, 0x1, 0xd, 0x9, 0x7, 0xb, 0x2, 0x6, 0xe,
+	};
+	int w = c->width, h = c->height, mx, my;
+	unsigned int q;
+
+	/* the halves split the cell exactly where lower and left eighths do */
+	mx = box_eighths(w, 4);
+	my = h - box_eighths(h, 4);
+
+	if (ch == 0x2580) {
+		box_fill_range(c, 0, 0, w, my);
+	} else if (ch <= 0x2588) {
+		box_fill_range(c, 0, h - box_eighths(h, ch - 0x2580), w, h);
+	} else if (ch <= 0x258f) {
+		box_fill_range(c, 0, 0, box_eighths(w, 0x2590 - ch), h);
+	} else if (ch == 0x2590) {
+		box_fill_range(c, mx, 0, w, h);
+	} else if (ch <= 0x2593) {
+		box_fill(c, 0, 0, w, h, (ch - 0x2590) * 0x40);
+	} else if (ch == 0x2594) {
+		box_fill_range(c, 0, 0, w, box_eighths(h, 1));
+	} else if (ch == 0x2595) {
+		box_fill_range(c, w - box_eighths(w, 1), 0, w, h);
+	} else {
+		q = quads[ch - 0x2596];
+		if (q & 0x1)
+			box_fill_range(c, 0, 0, mx, my);
+		if (q & 0x2)
+			box_fill_range(c, mx, 0, w, my);
+		if (q & 0x4)
+			box_fill_range(c, 0, my, mx, h);
+		if (q & 0x8)
+			box_fill_range(c, mx, my, w, h);
+	}
+}
+
+/* U+2800-U+28FF; dots 1-3 and 7 are the left, 4-6 and 8 the right column */
+static void box_draw_braille(struct box_canvas *c, uint32_t ch)
+{
+	static const uint8_t dots[8][2] = {
+		{ 0, 0 }, { 0, 1 }, { 0, 2 }, { 1, 0 },
+		{ 1, 1 }, { 1, 2 }, { 0, 3 }, { 1, 3 },
+	};
+	int w = c->width, h = c->height, size, x0, x1, y0, y1;
+	unsigned int i, bits = ch - BOX_BRAILLE_START;
+
+	size = w / 4 < h / 8 ? w / 4 : h / 8;
+	if (size < 1)
+		size = 1;
+
+	for (i = 0; i < 8; ++i) {
+		if (!(bits & (1 << i)))
+			continue;
+
+		x0 = dots[i][0] * w / 2;
+		x1 = (dots[i][0] + 1) * w / 2;
+		y0 = dots[i][1] * h / 4;
+		y1 = (dots[i][1] + 1) * h / 4;
+		box_fill(c, x0 + (x1 - x0 - size) / 2,
+			 y0 + (y1 - y0 - size) / 2, size, size, 0xff);
+	}
+}
+
+static void box_draw(const struct kmscon_font_box *box, struct box_canvas *c,
+		     uint32_t ch)
+{
+	if (ch >= BOX_BRAILLE_START)
+		box_draw_braille(c, ch);
+	else if (ch >= BOX_BLOCKS_START)
+		box_draw_block(c, ch);
+	else if ((ch >= 0x2504 && ch <= 0x250b) ||
+		 (ch >= 0x254c && ch <= 0x254f))
+		box_draw_dashes(box, c, ch);
+	else if (ch >= 0x256d && ch <= 0x2570)
+		box_draw_arc(box, c, ch);
+	else if (ch >= 0x2571 && ch <= 0x2573)
+		box_draw_diagonals(box, c, ch);
+	else
+		box_draw_arms(box, c, box_arms[ch - BOX_LINES_START]);
+}
+
+static unsigned int box_index(uint32_t ch)
+{
+	if (ch >= BOX_BRAILLE_START)
+		return BOX_BLOCKS_END - BOX_LINES_START +
+		       ch - BOX_BRAILLE_START;
+	return ch - BOX_LINES_START;
+}
+
+int kmscon_font_box_new(struct kmscon_font_box **out, unsigned int width,
+			unsigned int height)
+{
+	struct kmscon_font_box *box;
+	int ret;
+
+	if (!out || !width || !height)
+		return -EINVAL;
+
+	box = malloc(sizeof(*box));
+	if (!box)
+		return -ENOMEM;
+	memset(box, 0, sizeof(*box));
+	box->width = width;
+	box->height = height;
+
+	/* lines get thicker with the cell, heavy lines are twice as wide */
+	box->light = (width + 4) / 9;
+	if (!box->light)
+		box->light = 1;
+	box->heavy = box->light * 2;
+
+	ret = pthread_mutex_init(&box->lock, NULL);
+	if (ret) {
+		free(box);
+		return -ret;
+	}
+
+	log_debug("new box-drawing glyphs for %ux%u cells", width, height);
+	*out = box;
+	return 0;
+}
+
+void kmscon_font_box_free(struct kmscon_font_box *box)
+{
+	unsigned int i;
+
+	if (!box)
+		return;
+
+	for (i = 0; i < BOX_NUM; ++i) {
+		if (!box->glyphs[i])
+			continue;
+		free(box->glyphs[i]->buf.data);
+		free(box->glyphs[i]);
+	}
+
+	pthread_mutex_destroy(&box->lock);
+	free(box);
+}
+
+static int box_new_glyph(struct kmscon_font_box *box, uint32_t ch,
+			 struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyph;
+	struct box_canvas c;
+
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph)
+		return -ENOMEM;
+	memset(glyph, 0, sizeof(*glyph));
+
+	glyph->width = 1;
+	glyph->buf.width = box->width;
+	glyph->buf.height = box->height;
+	glyph->buf.stride = box->width;
+	glyph->buf.format = UTERM_FORMAT_GREY;
+	glyph->buf.data = calloc(box->height, box->width);
+	if (!glyph->buf.data) {
+		free(glyph);
+		return -ENOMEM;
+	}
+
+	c.data = glyph->buf.data;
+	c.width = box->width;
+	c.height = box->height;
+	box_draw(box, &c, ch);
+	kmscon_glyph_set_ink(glyph);
+
+	*out = glyph;
+	return 0;
+}
+
+/* Returns -ERANGE if @ch is not a procedural glyph */
+int kmscon_font_box_render(struct kmscon_font_box *box, uint32_t ch,
+			   const struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyph, **slot;
+	int ret = 0;
+
+	if (!kmscon_font_box_covers(ch))
+		return -ERANGE;
+
+	slot = &box->glyphs[box_index(ch)];
+	glyph = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+	if (glyph) {
+		*out = glyph;
+		return 0;
+	}
+
+	pthread_mutex_lock(&box->lock);
+
+	glyph = *slot;
+	if (!glyph) {
+		ret = box_new_glyph(box, ch, &glyph);
+		if (ret)
+			log_warning("cannot render box glyph U+%04X (%d)",
+				    (unsigned int)ch, ret);
+		else
+			__atomic_store_n(slot, glyph, __ATOMIC_RELEASE);
+	}
+
+	pthread_mutex_unlock(&box->lock);
+
+	if (!ret)
+		*out = glyph;
+	return ret;
+}
@@ -0,0 +1,1270 @@
+/*
+ * kmscon - Persistent Glyph Cache
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Persistent Glyph Cache
+ * A cache file contains a header with the face metrics, an array of entries
+ * sorted by code-point and the tightly packed A8 bitmaps of all entries. The
+ * file is mapped read-only and never modified. Instead, a new file is written
+ * next to it and renamed over the old one, so concurrent readers always see a
+ * consistent file.
+ *
+ * The file name is derived from a key over the backend, the font name, the
+ * resolved font file (path, size and mtime), the pixel size, the ppi and the
+ * style. Therefore, updating the font file or changing the font
+ * configuration automatically starts a new cache.
+ *
+ * In front of the file, the shared glyph store with the same key is used, so
+ * glyphs rendered by one kmscon process are used by all others without
+ * copies. Glyphs from the mapped file are not copied, either. Both kinds of
+ * glyphs have glyph->data set and reference memory owned by the cache.
+ *
+ * The cache also remembers which fallback face fontconfig picked for each block
+ * of code-points the face does not cover, so later misses in the same block do
+ * not run fontconfig again. These are stored in a small text file whose key
+ * additionally covers the fontconfig configuration files and font directories,
+ * so installing fonts or changing the configuration starts over.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <fontconfig/fontconfig.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include "font.h"
+#include "font_cache.h"
+#include "font_shm.h"
+#include "shl_log.h"
+#include "shl_misc.h"
+#include "shl_u32map.h"
+
+#define LOG_SUBSYSTEM "font_cache"
+
+#define CACHE_MAGIC 0x434c474b
+#define CACHE_VERSION 1
+#define CACHE_MAX_GLYPHS 65536
+
+/* fallback faces are resolved per block of 128 code-points */
+#define FALLBACK_SHIFT 7
+#define FALLBACK_MAGIC "kmscon-fallback"
+
+struct cache_header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t width;
+	uint32_t height;
+	uint32_t baseline;
+	uint32_t num;
+};
+
+struct cache_entry {
+	uint32_t ch;
+	uint32_t cwidth;
+	uint32_t width;
+	uint32_t height;
+	uint32_t offset;
+};
+
+struct cache_glyph {
+	uint32_t ch;
+	uint32_t cwidth;
+	uint32_t width;
+	uint32_t height;
+	const uint8_t *data;
+	uint8_t *buf;
+};
+
+/* Faces are unique by file and index. They are never freed before the cache
+ * as backends keep using their strings. */
+struct cache_fallback {
+	struct cache_fallback *next;
+	int index;
+	char *family;
+	char *file;
+	FcCharSet *charset;
+};
+
+/* The faces fontconfig picked for code-points of a block in the order they
+ * were picked, and the code-points of the block no face covers. */
+struct cache_block {
+	struct cache_block *next;
+	uint32_t block;
+	unsigned int num;
+	struct cache_fallback **faces;
+	uint32_t missing[(1U << FALLBACK_SHIFT) / 32];
+};
+
+SHL_U32MAP_DEFINE(fallback_map, struct cache_block)
+
+struct kmscon_font_cache {
+	char *path;
+	uint64_t key;
+	struct kmscon_font_shm *shm;
+	struct kmscon_font_attr attr;
+
+	/* read-only mapping of the current cache file */
+	uint8_t *map;
+	size_t size;
+	const struct cache_header *header;
+	const struct cache_entry *entries;
+
+	/* new data that is written back when the cache is freed */
+	pthread_mutex_t lock;
+	bool dirty;
+	bool has_metrics;
+	unsigned int width;
+	unsigned int height;
+	unsigned int baseline;
+	struct cache_glyph *glyphs;
+	size_t glyph_num;
+	size_t glyph_size;
+
+	/* fallback faces, protected by fb_lock */
+	pthread_mutex_t fb_lock;
+	char *fb_path;
+	uint64_t fb_key;
+	bool fb_dirty;
+	bool has_charset;
+	FcCharSet *charset;
+	struct fallback_map fallbacks;
+	struct cache_block *fb_blocks;
+	struct cache_fallback *fb_list;
+	unsigned long fb_hits;
+	unsigned long fb_misses;
+};
+
+static uint64_t hash_data(uint64_t hash, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	size_t i;
+
+	/* FNV-1a */
+	for (i = 0; i < len; ++i) {
+		hash ^= p[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+static uint64_t hash_str(uint64_t hash, const char *str)
+{
+	if (!str)
+		str = "";
+
+	/* include the terminating 0 so concatenations differ */
+	return hash_data(hash, str, strlen(str) + 1);
+}
+
+static uint64_t hash_uint(uint64_t hash, uint64_t val)
+{
+	return hash_data(hash, &val, sizeof(val));
+}
+
+static FcPattern *new_pattern(const struct kmscon_font_attr *attr)
+{
+	FcPattern *pat;
+
+	pat = FcNameParse((const FcChar8*)attr->name);
+	if (!pat)
+		return NULL;
+
+	FcPatternAddDouble(pat, FC_PIXEL_SIZE, attr->height);
+	FcPatternAddInteger(pat, FC_WEIGHT,
+			    attr->bold ? FC_WEIGHT_BOLD : FC_WEIGHT_REGULAR);
+	FcPatternAddInteger(pat, FC_SLANT,
+			    attr->italic ? FC_SLANT_ITALIC : FC_SLANT_ROMAN);
+	FcConfigSubstitute(NULL, pat, FcMatchPattern);
+	FcDefaultSubstitute(pat);
+
+	return pat;
+}
+
+static FcPattern *match_font(const struct kmscon_font_attr *attr)
+{
+	FcPattern *pat, *match;
+	FcResult res;
+
+	pat = new_pattern(attr);
+	if (!pat)
+		return NULL;
+
+	match = FcFontMatch(NULL, pat, &res);
+	FcPatternDestroy(pat);
+	return match;
+}
+
+/* Resolve the font file that fontconfig uses for @attr. Returns a newly
+ * allocated path or NULL. */
+static char *resolve_file(const struct kmscon_font_attr *attr)
+{
+	FcPattern *match;
+	FcChar8 *file;
+	char *path = NULL;
+
+	match = match_font(attr);
+	if (!match)
+		return NULL;
+
+	if (FcPatternGetString(match, FC_FILE, 0, &file) == FcResultMatch)
+		path = strdup((const char*)file);
+
+	FcPatternDestroy(match);
+	return path;
+}
+
+static uint64_t hash_files(uint64_t hash, FcStrList *list)
+{
+	FcChar8 *str;
+	struct stat st;
+
+	if (!list)
+		return hash;
+
+	while ((str = FcStrListNext(list))) {
+		hash = hash_str(hash, (const char*)str);
+		if (!stat((const char*)str, &st))
+			hash = hash_uint(hash, st.st_mtime);
+	}
+
+	FcStrListDone(list);
+	return hash;
+}
+
+/* Fallback resolution depends on all installed fonts, so the configuration
+ * files and font directories are part of the key of the fallback file. */
+static uint64_t hash_config(uint64_t hash)
+{
+	hash = hash_files(hash, FcConfigGetConfigFiles(NULL));
+	hash = hash_files(hash, FcConfigGetFontDirs(NULL));
+	return hash;
+}
+
+/* Create a unique temporary file in the directory of @path, so concurrent
+ * writers never share one. It is renamed over @path once it is complete. */
+static FILE *open_tmp(const char *path, const char *prefix, char **out)
+{
+	FILE *f;
+	int ret;
+
+	ret = shl_open_tmp(path, prefix, &f, out);
+	if (ret) {
+		log_debug("cannot create temporary file for %s (%d)", path,
+			  ret);
+		return NULL;
+	}
+
+	return f;
+}
+
+static char *get_dir(void)
+{
+	const char *env;
+	char *dir;
+	int ret;
+
+	env = getenv("KMSCON_FONT_CACHE_DIR");
+	if (env) {
+		if (!*env)
+			return NULL;
+		return strdup(env);
+	}
+
+	env = getenv("XDG_CACHE_HOME");
+	if (env && *env) {
+		ret = asprintf(&dir, "%s/kmscon", env);
+	} else {
+		env = getenv("HOME");
+		if (!env || !*env)
+			return NULL;
+		ret = asprintf(&dir, "%s/.cache/kmscon", env);
+	}
+
+	return ret < 0 ? NULL : dir;
+}
+
+/* Glyphs always have the cell size of one or two cells, so a corrupted file
+ * cannot make the blitters read beyond a bitmap. */
+static bool glyph_valid(const struct cache_header *h, uint32_t cwidth,
+			uint32_t width, uint32_t height)
+{
+	if (cwidth != 1 && cwidth != 2)
+		return false;
+	if (!h->width || !h->height)
+		return false;
+
+	return width && width <= (uint64_t)cwidth * h->width &&
+	       height == h->height;
+}
+
+static bool entry_valid(const struct cache_header *h,
+			const struct cache_entry *e, size_t size)
+{
+	uint64_t len = (uint64_t)e->width * e->height;
+
+	return glyph_valid(h, e->cwidth, e->width, e->height) &&
+	       e->offset <= size && len <= size - e->offset;
+}
+
+static void cache_map(struct kmscon_font_cache *cache)
+{
+	const struct cache_header *h;
+	const struct cache_entry *entries;
+	struct stat st;
+	void *map;
+	size_t i;
+	int fd;
+
+	fd = open(cache->path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return;
+
+	if (fstat(fd, &st) || st.st_size < (off_t)sizeof(*h)) {
+		close(fd);
+		return;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return;
+
+	h = map;
+	if (h->magic != CACHE_MAGIC || h->version != CACHE_VERSION ||
+	    h->key != cache->key || h->num > CACHE_MAX_GLYPHS ||
+	    sizeof(*h) + sizeof(struct cache_entry) * h->num >
+							(size_t)st.st_size) {
+		log_debug("ignoring invalid glyph cache %s", cache->path);
+		munmap(map, st.st_size);
+		return;
+	}
+
+	entries = (const void*)((const uint8_t*)map + sizeof(*h));
+	for (i = 0; i < h->num; ++i) {
+		if (!entry_valid(h, &entries[i], st.st_size)) {
+			log_debug("ignoring glyph cache %s with invalid entry",
+				  cache->path);
+			munmap(map, st.st_size);
+			return;
+		}
+	}
+
+	cache->map = map;
+	cache->size = st.st_size;
+	cache->header = h;
+	cache->entries = (const void*)(cache->map + sizeof(*h));
+	cache->has_metrics = h->width && h->height;
+	cache->width = h->width;
+	cache->height = h->height;
+	cache->baseline = h->baseline;
+
+	log_debug("using glyph cache %s with %u glyphs", cache->path, h->num);
+}
+
+/* Return the face @file/@index, adding it if it is not known, yet. Must be
+ * called with fb_lock held unless the cache is not shared, yet. */
+static struct cache_fallback *fallback__face(struct kmscon_font_cache *cache,
+					     int index, const char *family,
+					     const char *file,
+					     FcCharSet *charset)
+{
+	struct cache_fallback *fb;
+
+	for (fb = cache->fb_list; fb; fb = fb->next) {
+		if (fb->index != index || strcmp(fb->file, file))
+			continue;
+
+		/* prefer the charset fontconfig resolved the face with */
+		if (charset && (!fb->charset ||
+				!FcCharSetEqual(fb->charset, charset))) {
+			if (fb->charset)
+				FcCharSetDestroy(fb->charset);
+			fb->charset = FcCharSetCopy(charset);
+		}
+		return fb;
+	}
+
+	fb = malloc(sizeof(*fb));
+	if (!fb)
+		return NULL;
+	memset(fb, 0, sizeof(*fb));
+	fb->index = index;
+
+	fb->family = strdup(family);
+	fb->file = strdup(file);
+	if (!fb->family || !fb->file) {
+		free(fb->file);
+		free(fb->family);
+		free(fb);
+		return NULL;
+	}
+
+	if (charset)
+		fb->charset = FcCharSetCopy(charset);
+	fb->next = cache->fb_list;
+	cache->fb_list = fb;
+	return fb;
+}
+
+/* Return the entry of @block, adding an empty one if it is not known, yet.
+ * Same locking rules as fallback__face(). */
+static struct cache_block *fallback__block(struct kmscon_font_cache *cache,
+					   uint32_t block)
+{
+	struct cache_block *blk;
+
+	blk = fallback_map_find(&cache->fallbacks, block);
+	if (blk)
+		return blk;
+
+	blk = malloc(sizeof(*blk));
+	if (!blk)
+		return NULL;
+	memset(blk, 0, sizeof(*blk));
+	blk->block = block;
+
+	if (fallback_map_insert(&cache->fallbacks, block, blk)) {
+		free(blk);
+		return NULL;
+	}
+
+	blk->next = cache->fb_blocks;
+	cache->fb_blocks = blk;
+	return blk;
+}
+
+/* Add @fb to the faces of @blk. The number of faces is bounded by the number
+ * of distinct faces fontconfig picks, which is small. */
+static int fallback__link(struct cache_block *blk, struct cache_fallback *fb)
+{
+	struct cache_fallback **faces;
+	unsigned int i;
+
+	for (i = 0; i < blk->num; ++i) {
+		if (blk->faces[i] == fb)
+			return 0;
+	}
+
+	faces = realloc(blk->faces, sizeof(*faces) * (blk->num + 1));
+	if (!faces)
+		return -ENOMEM;
+
+	faces[blk->num++] = fb;
+	blk->faces = faces;
+	return 0;
+}
+
+/* Each line is "<block>\t<index>\t<family>\t<file>" after a header line with
+ * the key. Blocks with several faces have one line per face. */
+static void fallback_load(struct kmscon_font_cache *cache)
+{
+	char *line = NULL, *family, *file, *end;
+	struct cache_fallback *fb;
+	struct cache_block *blk;
+	unsigned long block;
+	size_t size = 0;
+	uint64_t key;
+	long index;
+	FILE *f;
+
+	f = fopen(cache->fb_path, "re");
+	if (!f)
+		return;
+
+	if (getline(&line, &size, f) < 0 ||
+	    sscanf(line, FALLBACK_MAGIC " %" SCNx64, &key) != 1 ||
+	    key != cache->fb_key) {
+		log_debug("ignoring invalid fallback cache %s", cache->fb_path);
+		goto out_file;
+	}
+
+	while (getline(&line, &size, f) > 0) {
+		line[strcspn(line, "\n")] = 0;
+
+		block = strtoul(line, &end, 16);
+		if (*end != '\t')
+			continue;
+		index = strtol(end + 1, &end, 10);
+		if (*end != '\t')
+			continue;
+		family = end + 1;
+		file = strchr(family, '\t');
+		if (!file)
+			continue;
+		*file++ = 0;
+		if (!*family || !*file || block > 0x10ffff >> FALLBACK_SHIFT)
+			continue;
+
+		fb = fallback__face(cache, index, family, file, NULL);
+		blk = fb ? fallback__block(cache, block) : NULL;
+		if (blk)
+			fallback__link(blk, fb);
+	}
+
+	log_debug("using fallback cache %s with %zu blocks", cache->fb_path,
+		  cache->fallbacks.num);
+
+out_file:
+	free(line);
+	fclose(f);
+}
+
+static void fallback_store(struct kmscon_font_cache *cache)
+{
+	struct cache_fallback *fb;
+	struct cache_block *blk;
+	unsigned int i;
+	char *tmp;
+	FILE *f;
+
+	f = open_tmp(cache->fb_path, "fallback", &tmp);
+	if (!f)
+		return;
+
+	fprintf(f, FALLBACK_MAGIC " %016" PRIx64 "\n", cache->fb_key);
+	for (blk = cache->fb_blocks; blk; blk = blk->next) {
+		for (i = 0; i < blk->num; ++i) {
+			fb = blk->faces[i];
+			if (strpbrk(fb->family, "\t\n") ||
+			    strpbrk(fb->file, "\t\n"))
+				continue;
+			fprintf(f, "%x\t%d\t%s\t%s\n", blk->block, fb->index,
+				fb->family, fb->file);
+		}
+	}
+
+	if (ferror(f)) {
+		fclose(f);
+		unlink(tmp);
+		goto out_tmp;
+	}
+
+	if (fclose(f) || rename(tmp, cache->fb_path))
+		unlink(tmp);
+
+out_tmp:
+	free(tmp);
+}
+
+static void fallback_free(struct kmscon_font_cache *cache)
+{
+	struct cache_fallback *fb;
+	struct cache_block *blk;
+
+	while ((blk = cache->fb_blocks)) {
+		cache->fb_blocks = blk->next;
+		free(blk->faces);
+		free(blk);
+	}
+
+	while ((fb = cache->fb_list)) {
+		cache->fb_list = fb->next;
+		if (fb->charset)
+			FcCharSetDestroy(fb->charset);
+		free(fb->file);
+		free(fb->family);
+		free(fb);
+	}
+
+	fallback_map_clear(&cache->fallbacks, NULL);
+	if (cache->charset)
+		FcCharSetDestroy(cache->charset);
+}
+
+/**
+ * kmscon_font_cache_new:
+ * @out: The new cache is stored here
+ * @backend: Name of the font backend that renders the glyphs
+ * @file: The font file that is used or NULL to resolve it via fontconfig
+ * @attr: The requested (normalized) font attributes
+ *
+ * Opens the cache for the given font. If neither a cache directory nor the
+ * shared glyph store is available, -EOPNOTSUPP is returned and the backend
+ * should simply work without a cache.
+ *
+ * Returns: 0 on success, negative error code on failure.
+ */
+int kmscon_font_cache_new(struct kmscon_font_cache **out,
+			  const char *backend, const char *file,
+			  const struct kmscon_font_attr *attr)
+{
+	struct kmscon_font_cache *cache;
+	uint64_t hash = 14695981039346656037ULL;
+	char *dir, *path = NULL;
+	struct stat st;
+	int ret;
+
+	if (!out || !backend || !attr)
+		return -EINVAL;
+
+	dir = get_dir();
+
+	if (!file) {
+		path = resolve_file(attr);
+		file = path;
+	}
+
+	hash = hash_str(hash, backend);
+	hash = hash_str(hash, attr->name);
+	hash = hash_str(hash, file);
+	if (file && !stat(file, &st)) {
+		hash = hash_uint(hash, st.st_size);
+		hash = hash_uint(hash, st.st_mtime);
+	}
+	hash = hash_uint(hash, attr->height);
+	hash = hash_uint(hash, attr->ppi);
+	hash = hash_uint(hash, attr->bold);
+	hash = hash_uint(hash, attr->italic);
+	free(path);
+
+	cache = malloc(sizeof(*cache));
+	if (!cache) {
+		ret = -ENOMEM;
+		goto err_dir;
+	}
+	memset(cache, 0, sizeof(*cache));
+	cache->key = hash;
+	cache->attr = *attr;
+	fallback_map_init(&cache->fallbacks);
+
+	ret = pthread_mutex_init(&cache->lock, NULL);
+	if (ret) {
+		ret = -EFAULT;
+		goto err_free;
+	}
+
+	ret = pthread_mutex_init(&cache->fb_lock, NULL);
+	if (ret) {
+		ret = -EFAULT;
+		goto err_lock;
+	}
+
+	if (dir) {
+		ret = asprintf(&cache->path, "%s/glyphs-%016" PRIx64 ".bin",
+			       dir, hash);
+		if (ret < 0) {
+			ret = -ENOMEM;
+			goto err_fb_lock;
+		}
+
+		cache_map(cache);
+
+		cache->fb_key = hash_config(hash);
+		ret = asprintf(&cache->fb_path,
+			       "%s/fallback-%016" PRIx64 ".txt", dir,
+			       cache->fb_key);
+		if (ret < 0)
+			cache->fb_path = NULL;
+		else
+			fallback_load(cache);
+	}
+
+	kmscon_font_shm_new(&cache->shm, hash);
+	if (!cache->path && !cache->shm) {
+		ret = -EOPNOTSUPP;
+		goto err_fb_lock;
+	}
+
+	free(dir);
+	*out = cache;
+	return 0;
+
+err_fb_lock:
+	pthread_mutex_destroy(&cache->fb_lock);
+err_lock:
+	pthread_mutex_destroy(&cache->lock);
+err_free:
+	free(cache);
+err_dir:
+	free(dir);
+	return ret;
+}
+
+static int glyph_cmp(const void *a, const void *b)
+{
+	const struct cache_glyph *g1 = a, *g2 = b;
+
+	if (g1->ch < g2->ch)
+		return -1;
+	return g1->ch > g2->ch;
+}
+
+/* Merge the mapped file with all new glyphs and write it atomically. */
+static void cache_store(struct kmscon_font_cache *cache)
+{
+	struct cache_header h;
+	struct cache_entry e;
+	struct cache_glyph *list, *g;
+	const struct cache_entry *old;
+	size_t i, num = 0, n, old_num;
+	uint64_t total;
+	uint32_t offset;
+	char *tmp;
+	FILE *f;
+
+	memset(&h, 0, sizeof(h));
+	h.magic = CACHE_MAGIC;
+	h.version = CACHE_VERSION;
+	h.key = cache->key;
+	h.width = cache->has_metrics ? cache->width : 0;
+	h.height = cache->has_metrics ? cache->height : 0;
+	h.baseline = cache->has_metrics ? cache->baseline : 0;
+
+	old_num = cache->header ? cache->header->num : 0;
+	list = malloc(sizeof(*list) * (old_num + cache->glyph_num));
+	if (!list)
+		return;
+
+	/* only keep glyphs that match the metrics of the new file */
+	for (i = 0; i < old_num; ++i) {
+		old = &cache->entries[i];
+		if (!entry_valid(cache->header, old, cache->size) ||
+		    !glyph_valid(&h, old->cwidth, old->width, old->height))
+			continue;
+
+		g = &list[num++];
+		g->ch = old->ch;
+		g->cwidth = old->cwidth;
+		g->width = old->width;
+		g->height = old->height;
+		g->data = cache->map + old->offset;
+	}
+
+	for (i = 0; i < cache->glyph_num; ++i) {
+		g = &cache->glyphs[i];
+		if (glyph_valid(&h, g->cwidth, g->width, g->height))
+			list[num++] = *g;
+	}
+	qsort(list, num, sizeof(*list), glyph_cmp);
+
+	/* drop duplicates */
+	for (i = 1, n = num ? 1 : 0; i < num; ++i) {
+		if (list[i].ch != list[n - 1].ch)
+			list[n++] = list[i];
+	}
+	num = n;
+	if (num > CACHE_MAX_GLYPHS)
+		num = CACHE_MAX_GLYPHS;
+
+	/* offsets are 32bit, drop the glyphs that do not fit */
+	total = sizeof(h) + sizeof(e) * num;
+	for (i = 0; i < num; ++i) {
+		total += (uint64_t)list[i].width * list[i].height;
+		if (total > UINT32_MAX) {
+			num = i;
+			break;
+		}
+	}
+
+	f = open_tmp(cache->path, "glyphs", &tmp);
+	if (!f)
+		goto out_list;
+
+	h.num = num;
+	if (fwrite(&h, sizeof(h), 1, f) != 1)
+		goto err_file;
+
+	offset = sizeof(h) + sizeof(e) * num;
+	for (i = 0; i < num; ++i) {
+		memset(&e, 0, sizeof(e));
+		e.ch = list[i].ch;
+		e.cwidth = list[i].cwidth;
+		e.width = list[i].width;
+		e.height = list[i].height;
+		e.offset = offset;
+		offset += e.width * e.height;
+		if (fwrite(&e, sizeof(e), 1, f) != 1)
+			goto err_file;
+	}
+
+	for (i = 0; i < num; ++i) {
+		n = (size_t)list[i].width * list[i].height;
+		if (n && fwrite(list[i].data, n, 1, f) != 1)
+			goto err_file;
+	}
+
+	if (fclose(f) || rename(tmp, cache->path)) {
+		unlink(tmp);
+		goto out_tmp;
+	}
+
+	log_debug("stored %zu glyphs in cache %s", num, cache->path);
+	goto out_tmp;
+
+err_file:
+	fclose(f);
+	unlink(tmp);
+out_tmp:
+	free(tmp);
+out_list:
+	free(list);
+}
+
+/**
+ * kmscon_font_cache_free:
+ * @cache: Cache object or NULL
+ *
+ * Writes all new glyphs back to disk and frees the cache. All glyphs returned
+ * by the cache must be freed before.
+ */
+void kmscon_font_cache_free(struct kmscon_font_cache *cache)
+{
+	size_t i;
+
+	if (!cache)
+		return;
+
+	if (cache->dirty && cache->path)
+		cache_store(cache);
+	if (cache->fb_dirty && cache->fb_path)
+		fallback_store(cache);
+	if (cache->fb_hits || cache->fb_misses)
+		log_debug("fallback cache: %lu hits, %lu misses",
+			  cache->fb_hits, cache->fb_misses);
+
+	for (i = 0; i < cache->glyph_num; ++i)
+		free(cache->glyphs[i].buf);
+	free(cache->glyphs);
+	kmscon_font_shm_free(cache->shm);
+	if (cache->map)
+		munmap(cache->map, cache->size);
+	fallback_free(cache);
+	pthread_mutex_destroy(&cache->fb_lock);
+	pthread_mutex_destroy(&cache->lock);
+	free(cache->fb_path);
+	free(cache->path);
+	free(cache);
+}
+
+/**
+ * kmscon_font_cache_get_metrics:
+ * @cache: Cache object or NULL
+ * @attr: Attributes to update with the cached width and height
+ * @baseline: The cached baseline is stored here
+ *
+ * Returns: true if the cache contains the face metrics, false otherwise.
+ */
+bool kmscon_font_cache_get_metrics(struct kmscon_font_cache *cache,
+				   struct kmscon_font_attr *attr,
+				   unsigned int *baseline)
+{
+	bool res = false;
+
+	if (!cache)
+		return false;
+
+	pthread_mutex_lock(&cache->lock);
+	if (cache->has_metrics) {
+		attr->width = cache->width;
+		attr->height = cache->height;
+		*baseline = cache->baseline;
+		res = true;
+	}
+	pthread_mutex_unlock(&cache->lock);
+
+	return res;
+}
+
+void kmscon_font_cache_set_metrics(struct kmscon_font_cache *cache,
+				   const struct kmscon_font_attr *attr,
+				   unsigned int baseline)
+{
+	if (!cache)
+		return;
+
+	pthread_mutex_lock(&cache->lock);
+	if (!cache->has_metrics || cache->width != attr->width ||
+	    cache->height != attr->height || cache->baseline != baseline) {
+		cache->has_metrics = true;
+		cache->width = attr->width;
+		cache->height = attr->height;
+		cache->baseline = baseline;
+		cache->dirty = true;
+	}
+	pthread_mutex_unlock(&cache->lock);
+}
+
+/**
+ * kmscon_font_cache_find:
+ * @cache: Cache object or NULL
+ * @out: A new glyph is stored here
+ * @ch: Symbol to look up
+ * @len: Length of @ch
+ *
+ * Looks up a glyph in the shared store and the mapped cache file. Only single
+ * code-points are cached. The returned glyph references memory of the cache
+ * and has glyph->data set. The caller must free the glyph but not its bitmap.
+ * This does not block on other threads.
+ *
+ * Returns: 0 on success, -ENOENT if the glyph is not cached.
+ */
+int kmscon_font_cache_find(struct kmscon_font_cache *cache,
+			   struct kmscon_glyph **out,
+			   const uint32_t *ch, size_t len)
+{
+	const struct cache_entry *e = NULL;
+	struct kmscon_glyph *glyph;
+	size_t lo, hi, mid;
+
+	if (!cache || len != 1)
+		return -ENOENT;
+
+	if (!kmscon_font_shm_find(cache->shm, out, *ch))
+		return 0;
+
+	if (!cache->header)
+		return -ENOENT;
+
+	lo = 0;
+	hi = cache->header->num;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (cache->entries[mid].ch == *ch) {
+			e = &cache->entries[mid];
+			break;
+		} else if (cache->entries[mid].ch < *ch) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if (!e || !entry_valid(cache->header, e, cache->size))
+		return -ENOENT;
+
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph)
+		return -ENOMEM;
+	memset(glyph, 0, sizeof(*glyph));
+	glyph->width = e->cwidth;
+	glyph->buf.width = e->width;
+	glyph->buf.height = e->height;
+	glyph->buf.stride = e->width;
+	glyph->buf.format = UTERM_FORMAT_GREY;
+	glyph->buf.data = cache->map + e->offset;
+	glyph->data = cache;
+	kmscon_glyph_set_ink(glyph);
+
+	*out = glyph;
+	return 0;
+}
+
+/**
+ * kmscon_font_cache_add:
+ * @cache: Cache object or NULL
+ * @ch: Symbol of @glyph
+ * @len: Length of @ch
+ * @glyph: The rendered A8 glyph
+ *
+ * Publishes *@glyph in the shared store and remembers it so it is written to
+ * disk when the cache is freed. Combined symbols are ignored as their IDs are
+ * not stable across restarts.
+ * If the glyph was published, *@glyph is freed and replaced by a glyph that
+ * references the shared copy, like the glyphs returned by
+ * kmscon_font_cache_find().
+ */
+void kmscon_font_cache_add(struct kmscon_font_cache *cache,
+			   const uint32_t *ch, size_t len,
+			   struct kmscon_glyph **glyph)
+{
+	const struct uterm_video_buffer *buf;
+	struct kmscon_glyph *shared;
+	struct cache_glyph *g;
+	size_t nsize, total;
+	unsigned int i;
+	const uint8_t *src;
+	uint8_t *data = NULL;
+
+	if (!cache || len != 1 || !glyph || !*glyph)
+		return;
+
+	buf = &(*glyph)->buf;
+	if (buf->format != UTERM_FORMAT_GREY || !buf->width || !buf->height)
+		return;
+
+	if (!kmscon_font_shm_add(cache->shm, &shared, *ch, *glyph)) {
+		free((*glyph)->buf.data);
+		free(*glyph);
+		*glyph = shared;
+		buf = &shared->buf;
+	}
+
+	if (!cache->path)
+		return;
+
+	/* shared bitmaps are tightly packed and live as long as the cache */
+	if ((*glyph)->data) {
+		src = buf->data;
+	} else {
+		data = malloc(buf->width * buf->height);
+		if (!data)
+			return;
+		for (i = 0; i < buf->height; ++i)
+			memcpy(&data[i * buf->width],
+			       &buf->data[i * buf->stride], buf->width);
+		src = data;
+	}
+
+	pthread_mutex_lock(&cache->lock);
+
+	total = cache->glyph_num;
+	if (cache->header)
+		total += cache->header->num;
+	if (total >= CACHE_MAX_GLYPHS)
+		goto err_unlock;
+
+	if (cache->glyph_num >= cache->glyph_size) {
+		nsize = cache->glyph_size ? cache->glyph_size * 2 : 64;
+		g = realloc(cache->glyphs, sizeof(*g) * nsize);
+		if (!g)
+			goto err_unlock;
+		cache->glyphs = g;
+		cache->glyph_size = nsize;
+	}
+
+	g = &cache->glyphs[cache->glyph_num++];
+	g->ch = *ch;
+	g->cwidth = (*glyph)->width;
+	g->width = buf->width;
+	g->height = buf->height;
+	g->data = src;
+	g->buf = data;
+	cache->dirty = true;
+
+	pthread_mutex_unlock(&cache->lock);
+	return;
+
+err_unlock:
+	pthread_mutex_unlock(&cache->lock);
+	free(data);
+}
+
+/* Faces loaded from disk get their charset on first use. Must be called with
+ * fb_lock held. */
+static FcCharSet *fallback__charset(struct cache_fallback *fb)
+{
+	FcPattern *pat;
+	FcCharSet *cs;
+	int count;
+
+	if (fb->charset)
+		return fb->charset;
+
+	pat = FcFreeTypeQuery((const FcChar8*)fb->file, fb->index, NULL,
+			      &count);
+	if (!pat)
+		return NULL;
+
+	if (FcPatternGetCharSet(pat, FC_CHARSET, 0, &cs) == FcResultMatch)
+		fb->charset = FcCharSetCopy(cs);
+
+	FcPatternDestroy(pat);
+	return fb->charset;
+}
+
+/* Run fontconfig fallback resolution for @ch. Must be called with fb_lock
+ * held. */
+static struct cache_fallback *fallback__resolve(struct kmscon_font_cache *cache,
+						uint32_t ch)
+{
+	struct cache_fallback *fb = NULL;
+	FcPattern *pat, *font;
+	FcFontSet *set;
+	FcCharSet *cs;
+	FcChar8 *file, *family;
+	FcResult res;
+	int i, index;
+
+	pat = new_pattern(&cache->attr);
+	if (!pat)
+		return NULL;
+
+	cs = FcCharSetCreate();
+	if (cs) {
+		FcCharSetAddChar(cs, ch);
+		FcPatternAddCharSet(pat, FC_CHARSET, cs);
+		FcCharSetDestroy(cs);
+	}
+
+	set = FcFontSort(NULL, pat, FcTrue, NULL, &res);
+	FcPatternDestroy(pat);
+	if (!set)
+		return NULL;
+
+	for (i = 0; i < set->nfont; ++i) {
+		font = set->fonts[i];
+		if (FcPatternGetCharSet(font, FC_CHARSET, 0, &cs) !=
+							FcResultMatch ||
+		    !FcCharSetHasChar(cs, ch))
+			continue;
+		if (FcPatternGetString(font, FC_FILE, 0, &file) !=
+							FcResultMatch ||
+		    FcPatternGetString(font, FC_FAMILY, 0, &family) !=
+							FcResultMatch)
+			continue;
+		if (FcPatternGetInteger(font, FC_INDEX, 0, &index) !=
+							FcResultMatch)
+			index = 0;
+
+		fb = fallback__face(cache, index, (const char*)family,
+				    (const char*)file, cs);
+		if (fb)
+			log_debug("using fallback %s for U+%04x", fb->family,
+				  ch);
+		break;
+	}
+
+	FcFontSetDestroy(set);
+	return fb;
+}
+
+/**
+ * kmscon_font_cache_covers:
+ * @cache: Cache object or NULL
+ * @ch: Code-point to check
+ *
+ * Checks whether the face fontconfig resolves for the cached font provides a
+ * glyph for @ch. If this is unknown, true is returned.
+ *
+ * Returns: false if a fallback face is needed for @ch, true otherwise.
+ */
+bool kmscon_font_cache_covers(struct kmscon_font_cache *cache, uint32_t ch)
+{
+	FcPattern *match;
+	FcCharSet *cs;
+	bool res;
+
+	if (!cache)
+		return true;
+
+	pthread_mutex_lock(&cache->fb_lock);
+
+	if (!cache->has_charset) {
+		cache->has_charset = true;
+		match = match_font(&cache->attr);
+		if (match) {
+			if (FcPatternGetCharSet(match, FC_CHARSET, 0, &cs) ==
+								FcResultMatch)
+				cache->charset = FcCharSetCopy(cs);
+			FcPatternDestroy(match);
+		}
+	}
+
+	res = !cache->charset || FcCharSetHasChar(cache->charset, ch);
+
+	pthread_mutex_unlock(&cache->fb_lock);
+	return res;
+}
+
+/**
+ * kmscon_font_cache_get_fallback:
+ * @cache: Cache object or NULL
+ * @ch: Code-point that needs a fallback face
+ * @out: The fallback face is stored here
+ *
+ * Returns the face that fontconfig falls back to for @ch. The faces resolved for
+ * a block of code-points are reused for all code-points of the block they
+ * cover, also across restarts. Code-points no face covers are remembered, too,
+ * so fontconfig runs at most once for each of them. The strings in @out are
+ * valid until the cache is freed.
+ *
+ * Returns: 0 on success, -ENOENT if no face covers @ch, -EOPNOTSUPP if @cache
+ * is NULL.
+ */
+int kmscon_font_cache_get_fallback(struct kmscon_font_cache *cache,
+				   uint32_t ch,
+				   struct kmscon_font_fallback *out)
+{
+	struct cache_fallback *fb = NULL;
+	struct cache_block *blk;
+	uint32_t bit, mask;
+	FcCharSet *cs;
+	unsigned int i;
+
+	if (!cache)
+		return -EOPNOTSUPP;
+	if (!out)
+		return -EINVAL;
+
+	bit = ch & ((1U << FALLBACK_SHIFT) - 1);
+	mask = 1U << (bit % 32);
+
+	pthread_mutex_lock(&cache->fb_lock);
+
+	blk = fallback_map_find(&cache->fallbacks, ch >> FALLBACK_SHIFT);
+	for (i = 0; blk && i < blk->num; ++i) {
+		cs = fallback__charset(blk->faces[i]);
+		if (cs && FcCharSetHasChar(cs, ch)) {
+			fb = blk->faces[i];
+			break;
+		}
+	}
+
+	if (fb || (blk && (blk->missing[bit / 32] & mask))) {
+		++cache->fb_hits;
+	} else {
+		++cache->fb_misses;
+		fb = fallback__resolve(cache, ch);
+		if (!blk)
+			blk = fallback__block(cache, ch >> FALLBACK_SHIFT);
+		if (blk && fb) {
+			if (!fallback__link(blk, fb))
+				cache->fb_dirty = true;
+		} else if (blk) {
+			blk->missing[bit / 32] |= mask;
+		}
+	}
+
+	if (fb) {
+		out->family = fb->family;
+		out->file = fb->file;
+		out->index = fb->index;
+	}
+
+	pthread_mutex_unlock(&cache->fb_lock);
+
+	return fb ? 0 : -ENOENT;
+}
+
+void kmscon_font_cache_get_fallback_stats(struct kmscon_font_cache *cache,
+					  unsigned long *hits,
+					  unsigned long *misses)
+{
+	if (!cache)
+		return;
+
+	pthread_mutex_lock(&cache->fb_lock);
+	*hits = cache->fb_hits;
+	*misses = cache->fb_misses;
+	pthread_mutex_unlock(&cache->fb_lock);
+}
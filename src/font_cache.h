@@ -0,0 +1,83 @@
+/*
+ * kmscon - Persistent Glyph Cache
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Persistent Glyph Cache
+ * Scalable font backends can store the face metrics and the rendered A8
+ * bitmaps of single code-points on disk. The cache file is mapped into memory
+ * and glyphs are looked up lazily, so a restart does not have to rasterize
+ * glyphs that were used before. New glyphs are collected in memory and written
+ * to a new cache file when the face is destroyed. Single glyphs are shared
+ * with other kmscon processes via the shared glyph store (see font_shm.h).
+ * The cache also remembers the fallback faces fontconfig resolves for
+ * code-points the face does not cover.
+ * The pango and freetype modules each link their own copy of font_cache.c, so
+ * they only share the files on disk, never any state in memory.
+ */
+
+#ifndef KMSCON_FONT_CACHE_H
+#define KMSCON_FONT_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "font.h"
+
+struct kmscon_font_cache;
+
+struct kmscon_font_fallback {
+	const char *family;
+	const char *file;
+	int index;
+};
+
+int kmscon_font_cache_new(struct kmscon_font_cache **out,
+			  const char *backend, const char *file,
+			  const struct kmscon_font_attr *attr);
+void kmscon_font_cache_free(struct kmscon_font_cache *cache);
+
+bool kmscon_font_cache_get_metrics(struct kmscon_font_cache *cache,
+				   struct kmscon_font_attr *attr,
+				   unsigned int *baseline);
+void kmscon_font_cache_set_metrics(struct kmscon_font_cache *cache,
+				   const struct kmscon_font_attr *attr,
+				   unsigned int baseline);
+
+int kmscon_font_cache_find(struct kmscon_font_cache *cache,
+			   struct kmscon_glyph **out,
+			   const uint32_t *ch, size_t len);
+void kmscon_font_cache_add(struct kmscon_font_cache *cache,
+			   const uint32_t *ch, size_t len,
+			   struct kmscon_glyph **glyph);
+
+bool kmscon_font_cache_covers(struct kmscon_font_cache *cache, uint32_t ch);
+int kmscon_font_cache_get_fallback(struct kmscon_font_cache *cache,
+				   uint32_t ch,
+				   struct kmscon_font_fallback *out);
+void kmscon_font_cache_get_fallback_stats(struct kmscon_font_cache *cache,
+					  unsigned long *hits,
+					  unsigned long *misses);
+
+#endif /* KMSCON_FONT_CACHE_H */
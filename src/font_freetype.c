@@ -0,0 +1,863 @@
+/*
+ * kmscon - FreeType font backend
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * SECTION:font_freetype.c
+ * @short_description: FreeType font backend
+ * @include: font.h
+ *
+ * The freetype backend resolves the requested font once via fontconfig and
+ * then renders glyphs directly with FreeType into the cell bitmap. No text
+ * layout is done, so this is much cheaper than the pango backend but it only
+ * works for single code-points which do not require shaping. Code-points that
+ * are not available in the selected face are rendered with the fallback face
+ * fontconfig picks for them, which the persistent cache remembers per block of
+ * code-points. Combined characters, complex scripts and code-points without
+ * fallback face are passed to the pango backend, if it is available, and the
+ * result is copied into a cell-sized glyph.
+ *
+ * Recently used glyphs are cached in a bounded glyph table per face, which is
+ * shared with the pango backend (see font_glyphs.h). Faces are shared between
+ * all fonts with the same attributes. Glyphs of single code-points are
+ * additionally stored in the persistent glyph cache.
+ */
+
+#include <errno.h>
+#include <fontconfig/fontconfig.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_SYNTHESIS_H
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "font.h"
+#include "font_cache.h"
+#include "font_glyphs.h"
+#include "font_width.h"
+#include "shl_dlist.h"
+#include "shl_log.h"
+#include "shl_lru.h"
+#include "shl_u32map.h"
+#include "uterm_video.h"
+
+#define LOG_SUBSYSTEM "font_freetype"
+
+struct fallback_face;
+
+struct face {
+	unsigned long ref;
+	struct shl_dlist list;
+
+	struct kmscon_font_attr attr;
+	struct kmscon_font_attr real_attr;
+	unsigned int baseline;
+	FT_Face ft;
+	bool embolden;
+	bool oblique;
+
+	pthread_mutex_t glyph_lock;
+	struct glyph_map glyphs;
+	struct shl_lru lru;
+	struct cached_glyph **fast;
+	struct kmscon_font *fallback;
+	bool fallback_failed;
+	struct fallback_face *fallback_faces;
+	struct kmscon_font_cache *cache;
+};
+
+/* fallback faces resolved via the font cache; @file is owned by the cache */
+struct fallback_face {
+	struct fallback_face *next;
+	const char *file;
+	int index;
+	FT_Face ft;
+};
+
+static pthread_mutex_t manager_mutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long manager__refcnt;
+static FT_Library manager__lib;
+static struct shl_dlist manager__list = SHL_DLIST_INIT(manager__list);
+
+static void manager_lock()
+{
+	pthread_mutex_lock(&manager_mutex);
+}
+
+static void manager_unlock()
+{
+	pthread_mutex_unlock(&manager_mutex);
+}
+
+static int manager__ref()
+{
+	FT_Error err;
+
+	if (!manager__refcnt++) {
+		err = FT_Init_FreeType(&manager__lib);
+		if (err) {
+			log_warn("cannot initialize freetype (%d)", err);
+			--manager__refcnt;
+			return -EFAULT;
+		}
+	}
+
+	return 0;
+}
+
+static void manager__unref()
+{
+	if (!--manager__refcnt) {
+		FT_Done_FreeType(manager__lib);
+		manager__lib = NULL;
+	}
+}
+
+/* Scripts that need shaping to look right. Everything in these ranges is
+ * rendered via the fallback. */
+static const struct {
+	uint32_t first;
+	uint32_t last;
+} complex_ranges[] = {
+	{ 0x0600, 0x08ff },	/* Arabic, Syriac, Thaana, NKo, ... */
+	{ 0x0900, 0x0dff },	/* Indic scripts */
+	{ 0x0f00, 0x0fff },	/* Tibetan */
+	{ 0x1000, 0x109f },	/* Myanmar */
+	{ 0x1780, 0x18af },	/* Khmer, Mongolian */
+	{ 0x1a00, 0x1aaf },	/* Buginese, Tai Tham */
+	{ 0x1b00, 0x1c4f },	/* Balinese, Sundanese, Batak, Lepcha */
+	{ 0xa800, 0xa82f },	/* Syloti Nagri */
+	{ 0xa840, 0xa8ff },	/* Phags-pa, Saurashtra, Devanagari Ext. */
+	{ 0xa980, 0xaadf },	/* Javanese, Cham, Myanmar Ext., Tai Viet */
+	{ 0xabc0, 0xabff },	/* Meetei Mayek */
+};
+
+static bool needs_shaping(const uint32_t *ch, size_t len)
+{
+	size_t i, num;
+
+	if (len > 1)
+		return true;
+
+	num = sizeof(complex_ranges) / sizeof(*complex_ranges);
+	for (i = 0; i < num; ++i) {
+		if (*ch < complex_ranges[i].first)
+			return false;
+		if (*ch <= complex_ranges[i].last)
+			return true;
+	}
+
+	return false;
+}
+
+static int new_glyph(struct face *face, struct kmscon_glyph **out,
+		     unsigned int cwidth)
+{
+	struct kmscon_glyph *glyph;
+
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph) {
+		log_error("cannot allocate memory for new glyph");
+		return -ENOMEM;
+	}
+	memset(glyph, 0, sizeof(*glyph));
+	glyph->width = cwidth;
+	glyph->buf.width = face->real_attr.width * cwidth;
+	glyph->buf.height = face->real_attr.height;
+	glyph->buf.stride = glyph->buf.width;
+	glyph->buf.format = UTERM_FORMAT_GREY;
+
+	glyph->buf.data = malloc(glyph->buf.height * glyph->buf.stride);
+	if (!glyph->buf.data) {
+		log_error("cannot allocate bitmap memory");
+		free(glyph);
+		return -ENOMEM;
+	}
+	memset(glyph->buf.data, 0, glyph->buf.height * glyph->buf.stride);
+
+	*out = glyph;
+	return 0;
+}
+
+/* Copy a freetype bitmap into @glyph so its origin is at @x/@y. Everything
+ * outside of the cell is clipped. */
+static int blit_bitmap(struct kmscon_glyph *glyph, const FT_Bitmap *bitmap,
+		       int x, int y)
+{
+	unsigned int i, j;
+	int dx, dy;
+	const unsigned char *src;
+	uint8_t *dst;
+
+	if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY &&
+	    bitmap->pixel_mode != FT_PIXEL_MODE_MONO)
+		return -EOPNOTSUPP;
+
+	for (i = 0; i < bitmap->rows; ++i) {
+		dy = y + (int)i;
+		if (dy < 0)
+			continue;
+		if (dy >= (int)glyph->buf.height)
+			break;
+
+		/* negative pitch means the rows are stored bottom-up */
+		if (bitmap->pitch >= 0)
+			src = &bitmap->buffer[i * bitmap->pitch];
+		else
+			src = &bitmap->buffer[(bitmap->rows - 1 - i) *
+					      -bitmap->pitch];
+		dst = &glyph->buf.data[dy * glyph->buf.stride];
+
+		for (j = 0; j < bitmap->width; ++j) {
+			dx = x + (int)j;
+			if (dx < 0)
+				continue;
+			if (dx >= (int)glyph->buf.width)
+				break;
+
+			if (bitmap->pixel_mode == FT_PIXEL_MODE_GRAY)
+				dst[dx] = src[j];
+			else if (src[j / 8] & (0x80 >> (j % 8)))
+				dst[dx] = 0xff;
+		}
+	}
+
+	return 0;
+}
+
+/* Render @ch directly via freetype with @ft, which is the face or one of its
+ * fallback faces. Returns -ENOENT if @ft does not provide the glyph. Must be
+ * called with glyph_lock held. */
+static int render_direct(struct face *face, FT_Face ft,
+			 struct kmscon_glyph **out, uint32_t ch,
+			 unsigned int cwidth)
+{
+	struct kmscon_glyph *glyph;
+	FT_GlyphSlot slot;
+	FT_UInt idx;
+	FT_Error err;
+	int ret;
+
+	idx = FT_Get_Char_Index(ft, ch);
+	if (!idx)
+		return -ENOENT;
+
+	err = FT_Load_Glyph(ft, idx, FT_LOAD_DEFAULT);
+	if (err)
+		return -ENOENT;
+
+	slot = ft->glyph;
+	if (face->embolden)
+		FT_GlyphSlot_Embolden(slot);
+	if (face->oblique)
+		FT_GlyphSlot_Oblique(slot);
+
+	err = FT_Render_Glyph(slot, FT_RENDER_MODE_NORMAL);
+	if (err)
+		return -ENOENT;
+
+	ret = new_glyph(face, &glyph, cwidth);
+	if (ret)
+		return ret;
+
+	ret = blit_bitmap(glyph, &slot->bitmap, slot->bitmap_left,
+			  (int)face->baseline - slot->bitmap_top);
+	if (ret) {
+		font_glyph_free(glyph);
+		return -ENOENT;
+	}
+
+	kmscon_glyph_set_ink(glyph);
+	*out = glyph;
+	return 0;
+}
+
+static void free_fallback_faces(struct face *face)
+{
+	struct fallback_face *ff;
+
+	while ((ff = face->fallback_faces)) {
+		face->fallback_faces = ff->next;
+		if (ff->ft)
+			FT_Done_Face(ff->ft);
+		free(ff);
+	}
+}
+
+/* Render @ch with the fallback face fontconfig resolves for it. The font cache
+ * remembers it per block of code-points, so this usually does not run
+ * fontconfig at all. Must be called with glyph_lock held. */
+static int render_cached_fallback(struct face *face, struct kmscon_glyph **out,
+				  uint32_t ch, unsigned int cwidth)
+{
+	struct kmscon_font_fallback fb;
+	struct fallback_face *ff;
+	FT_Error err;
+
+	if (kmscon_font_cache_get_fallback(face->cache, ch, &fb))
+		return -ENOENT;
+
+	for (ff = face->fallback_faces; ff; ff = ff->next) {
+		if (ff->index == fb.index && !strcmp(ff->file, fb.file))
+			break;
+	}
+
+	if (!ff) {
+		ff = malloc(sizeof(*ff));
+		if (!ff)
+			return -ENOMEM;
+		memset(ff, 0, sizeof(*ff));
+		ff->file = fb.file;
+		ff->index = fb.index;
+
+		/* the library is shared by all faces */
+		manager_lock();
+		err = FT_New_Face(manager__lib, fb.file, fb.index, &ff->ft);
+		if (err) {
+			ff->ft = NULL;
+		} else if (!FT_IS_SCALABLE(ff->ft) ||
+			   FT_Set_Pixel_Sizes(ff->ft, 0, face->attr.height)) {
+			FT_Done_Face(ff->ft);
+			ff->ft = NULL;
+		}
+		manager_unlock();
+
+		if (ff->ft)
+			log_debug("using fallback font file %s (%d)", fb.file,
+				  fb.index);
+		else
+			log_debug("cannot use fallback font file %s (%d)",
+				  fb.file, fb.index);
+
+		ff->next = face->fallback_faces;
+		face->fallback_faces = ff;
+	}
+
+	if (!ff->ft)
+		return -ENOENT;
+
+	return render_direct(face, ff->ft, out, ch, cwidth);
+}
+
+/* Render @ch via the pango backend and copy it into a cell-sized glyph, aligned
+ * on the baseline. Must be called with glyph_lock held. */
+static int render_fallback(struct face *face, struct kmscon_glyph **out,
+			   uint32_t id, const uint32_t *ch, size_t len,
+			   unsigned int cwidth)
+{
+	const struct kmscon_glyph *fglyph;
+	struct kmscon_glyph *glyph;
+	unsigned int i, w, h;
+	int ret, y;
+
+	if (!face->fallback && !face->fallback_failed) {
+		ret = kmscon_font_find(&face->fallback, &face->real_attr,
+				       "pango");
+		if (!ret && strcmp(face->fallback->ops->name, "pango")) {
+			kmscon_font_unref(face->fallback);
+			face->fallback = NULL;
+		}
+
+		if (!face->fallback) {
+			log_debug("pango fallback not available");
+			face->fallback_failed = true;
+		}
+	}
+
+	if (!face->fallback)
+		return -ERANGE;
+
+	ret = kmscon_font_render(face->fallback, id, ch, len, &fglyph);
+	if (ret)
+		return ret;
+	if (fglyph->buf.format != UTERM_FORMAT_GREY)
+		return -ERANGE;
+
+	ret = new_glyph(face, &glyph, cwidth);
+	if (ret)
+		return ret;
+
+	w = fglyph->buf.width;
+	if (w > glyph->buf.width)
+		w = glyph->buf.width;
+	h = fglyph->buf.height;
+
+	for (i = 0; i < h; ++i) {
+		y = (int)i + (int)face->baseline -
+		    (int)face->fallback->baseline;
+		if (y < 0)
+			continue;
+		if (y >= (int)glyph->buf.height)
+			break;
+
+		memcpy(&glyph->buf.data[y * glyph->buf.stride],
+		       &fglyph->buf.data[i * fglyph->buf.stride], w);
+	}
+
+	kmscon_glyph_set_ink(glyph);
+	*out = glyph;
+	return 0;
+}
+
+/* If @render is false, glyphs that are neither in the glyph table nor in the
+ * persistent cache are not rasterized and -EAGAIN is returned instead. */
+static int get_glyph(struct face *face, struct kmscon_glyph **out,
+		     uint32_t id, const uint32_t *ch, size_t len, bool render)
+{
+	struct kmscon_glyph *glyph;
+	struct cached_glyph *cg;
+	unsigned int cwidth;
+	int ret;
+
+	/* glyphs are only evicted by the rendering thread which is also the
+	 * only one using this lock-free path */
+	if (id < KMSCON_GLYPH_FAST_NUM) {
+		cg = __atomic_load_n(&face->fast[id], __ATOMIC_ACQUIRE);
+		if (cg) {
+			shl_lru_mark(&face->lru, &cg->lru,
+				     kmscon_font_get_epoch());
+			*out = cg->glyph;
+			return 0;
+		}
+	}
+
+	if (!len)
+		return -ERANGE;
+	cwidth = kmscon_ucs4_get_width(*ch);
+	if (!cwidth)
+		return -ERANGE;
+
+	pthread_mutex_lock(&face->glyph_lock);
+
+	cg = glyph_map_find(&face->glyphs, id);
+	if (cg) {
+		shl_lru_touch(&face->lru, &cg->lru, kmscon_font_get_epoch());
+		glyph = cg->glyph;
+		ret = 0;
+		goto out_unlock;
+	}
+
+	ret = kmscon_font_cache_find(face->cache, &glyph, ch, len);
+	if (ret && !render) {
+		ret = -EAGAIN;
+		goto out_unlock;
+	} else if (ret) {
+		if (needs_shaping(ch, len))
+			ret = -ENOENT;
+		else
+			ret = render_direct(face, face->ft, &glyph, *ch,
+					    cwidth);
+
+		if (ret == -ENOENT && len == 1)
+			ret = render_cached_fallback(face, &glyph, *ch,
+						     cwidth);
+
+		if (ret == -ENOENT)
+			ret = render_fallback(face, &glyph, id, ch, len,
+					      cwidth);
+		if (ret)
+			goto out_unlock;
+
+		kmscon_font_cache_add(face->cache, ch, len, &glyph);
+	}
+
+	cg = malloc(sizeof(*cg));
+	if (!cg) {
+		font_glyph_free(glyph);
+		ret = -ENOMEM;
+		goto out_unlock;
+	}
+	cg->id = id;
+	cg->glyph = glyph;
+
+	ret = glyph_map_insert(&face->glyphs, id, cg);
+	if (ret) {
+		log_error("cannot add glyph to glyph table");
+		font_cached_glyph_free(cg);
+		goto out_unlock;
+	}
+
+	shl_lru_add(&face->lru, &cg->lru, font_glyph_size(glyph),
+		    kmscon_font_get_epoch());
+	if (id < KMSCON_GLYPH_FAST_NUM)
+		__atomic_store_n(&face->fast[id], cg, __ATOMIC_RELEASE);
+	font_glyphs_evict(&face->glyphs, &face->lru, face->fast);
+
+out_unlock:
+	pthread_mutex_unlock(&face->glyph_lock);
+	if (!ret)
+		*out = glyph;
+	return ret;
+}
+
+/* Resolve @attr via fontconfig and open the matching face. */
+static int open_face(struct face *face, const struct kmscon_font_attr *attr)
+{
+	FcPattern *pat, *match;
+	FcResult res;
+	FcChar8 *file;
+	FcBool emb;
+	int index, weight, slant, ret;
+	FT_Error err;
+
+	pat = FcNameParse((const FcChar8*)attr->name);
+	if (!pat)
+		return -ENOMEM;
+
+	FcPatternAddDouble(pat, FC_PIXEL_SIZE, attr->height);
+	FcPatternAddInteger(pat, FC_WEIGHT,
+			    attr->bold ? FC_WEIGHT_BOLD : FC_WEIGHT_REGULAR);
+	FcPatternAddInteger(pat, FC_SLANT,
+			    attr->italic ? FC_SLANT_ITALIC : FC_SLANT_ROMAN);
+	FcConfigSubstitute(NULL, pat, FcMatchPattern);
+	FcDefaultSubstitute(pat);
+
+	match = FcFontMatch(NULL, pat, &res);
+	FcPatternDestroy(pat);
+	if (!match) {
+		log_warning("no font matches %s", attr->name);
+		return -ENOENT;
+	}
+
+	if (FcPatternGetString(match, FC_FILE, 0, &file) != FcResultMatch) {
+		log_warning("font match for %s has no file", attr->name);
+		ret = -ENOENT;
+		goto out_match;
+	}
+	if (FcPatternGetInteger(match, FC_INDEX, 0, &index) != FcResultMatch)
+		index = 0;
+	if (FcPatternGetInteger(match, FC_WEIGHT, 0, &weight) != FcResultMatch)
+		weight = FC_WEIGHT_REGULAR;
+	if (FcPatternGetInteger(match, FC_SLANT, 0, &slant) != FcResultMatch)
+		slant = FC_SLANT_ROMAN;
+	if (FcPatternGetBool(match, FC_EMBOLDEN, 0, &emb) != FcResultMatch)
+		emb = FcFalse;
+
+	/* synthesize styles the matched face does not provide */
+	face->embolden = attr->bold && (emb || weight < FC_WEIGHT_DEMIBOLD);
+	face->oblique = attr->italic && slant == FC_SLANT_ROMAN;
+
+	log_debug("using font file %s (%d) for %s", file, index, attr->name);
+
+	err = FT_New_Face(manager__lib, (const char*)file, index, &face->ft);
+	if (err) {
+		log_warning("cannot open font file %s (%d)", file, err);
+		ret = -EFAULT;
+		goto out_match;
+	}
+
+	/* the cache is optional so errors are ignored */
+	kmscon_font_cache_new(&face->cache, "freetype", (const char*)file,
+			      attr);
+	ret = 0;
+
+out_match:
+	FcPatternDestroy(match);
+	return ret;
+}
+
+/* Select the pixel size and compute the cell metrics of the face. */
+static int measure_face(struct face *face)
+{
+	FT_Face ft = face->ft;
+	FT_Size_Metrics *m;
+	int i, best, diff;
+	long asc, desc, adv;
+	FT_Error err;
+
+	if (FT_IS_SCALABLE(ft)) {
+		err = FT_Set_Pixel_Sizes(ft, 0, face->attr.height);
+	} else if (ft->num_fixed_sizes > 0) {
+		best = 0;
+		for (i = 1; i < ft->num_fixed_sizes; ++i) {
+			diff = abs(ft->available_sizes[i].height -
+				   (int)face->attr.height);
+			if (diff < abs(ft->available_sizes[best].height -
+				       (int)face->attr.height))
+				best = i;
+		}
+		err = FT_Select_Size(ft, best);
+	} else {
+		return -EINVAL;
+	}
+	if (err) {
+		log_warning("cannot set font size (%d)", err);
+		return -EFAULT;
+	}
+
+	m = &ft->size->metrics;
+	asc = (m->ascender + 63) >> 6;
+	desc = (-m->descender + 63) >> 6;
+
+	if (!FT_Load_Char(ft, 'M', FT_LOAD_DEFAULT))
+		adv = (ft->glyph->advance.x + 63) >> 6;
+	else
+		adv = (m->max_advance + 63) >> 6;
+
+	if (asc <= 0 || asc + desc <= 0 || adv <= 0)
+		return -EINVAL;
+
+	memcpy(&face->real_attr, &face->attr, sizeof(face->attr));
+	face->real_attr.height = asc + desc;
+	face->real_attr.width = adv;
+	face->baseline = asc;
+	kmscon_font_attr_normalize(&face->real_attr);
+
+	return 0;
+}
+
+static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
+{
+	struct shl_dlist *iter;
+	struct face *face, *f;
+	struct kmscon_font_cache *cache = NULL;
+	int ret;
+
+	manager_lock();
+
+	shl_dlist_for_each(iter, &manager__list) {
+		face = shl_dlist_entry(iter, struct face, list);
+		if (kmscon_font_attr_match(&face->attr, attr)) {
+			++face->ref;
+			*out = face;
+			ret = 0;
+			goto out_unlock;
+		}
+	}
+
+	ret = manager__ref();
+	if (ret)
+		goto out_unlock;
+
+	face = malloc(sizeof(*face));
+	if (!face) {
+		log_error("cannot allocate memory for new face");
+		ret = -ENOMEM;
+		goto err_manager;
+	}
+	memset(face, 0, sizeof(*face));
+	face->ref = 1;
+	memcpy(&face->attr, attr, sizeof(*attr));
+	shl_lru_init(&face->lru, kmscon_font_get_cache_limit());
+
+	ret = pthread_mutex_init(&face->glyph_lock, NULL);
+	if (ret) {
+		log_error("cannot initialize glyph lock");
+		goto err_free;
+	}
+
+	face->fast = calloc(KMSCON_GLYPH_FAST_NUM, sizeof(*face->fast));
+	if (!face->fast) {
+		log_error("cannot allocate glyph array");
+		ret = -ENOMEM;
+		goto err_lock;
+	}
+
+	ret = open_face(face, attr);
+	if (ret)
+		goto err_fast;
+
+	ret = measure_face(face);
+	if (ret) {
+		log_warning("invalid scaled font sizes");
+		goto err_face;
+	}
+
+	/* the cache only keeps glyphs that match the recorded metrics */
+	kmscon_font_cache_set_metrics(face->cache, &face->real_attr,
+				      face->baseline);
+
+	/* The real metrics probably differ from the requested metrics so try
+	 * again to find a suitable cached font. */
+	shl_dlist_for_each(iter, &manager__list) {
+		f = shl_dlist_entry(iter, struct face, list);
+		if (kmscon_font_attr_match(&f->real_attr, &face->real_attr)) {
+			++f->ref;
+			*out = f;
+			ret = 0;
+			goto err_face;
+		}
+	}
+
+	shl_dlist_link(&manager__list, &face->list);
+	*out = face;
+	ret = 0;
+	goto out_unlock;
+
+err_face:
+	cache = face->cache;
+	FT_Done_Face(face->ft);
+err_fast:
+	free(face->fast);
+err_lock:
+	pthread_mutex_destroy(&face->glyph_lock);
+err_free:
+	free(face);
+err_manager:
+	manager__unref();
+out_unlock:
+	manager_unlock();
+	/* writing the cache may block on the disk, so do it unlocked */
+	kmscon_font_cache_free(cache);
+	return ret;
+}
+
+static void manager_put_face(struct face *face)
+{
+	struct kmscon_font *fallback = NULL;
+	struct kmscon_font_cache *cache = NULL;
+
+	manager_lock();
+
+	if (!--face->ref) {
+		shl_dlist_unlink(&face->list);
+		fallback = face->fallback;
+		log_debug("glyph cache: %lu glyphs, %zu bytes, %lu evictions",
+			  face->lru.entries, face->lru.size,
+			  face->lru.evictions);
+		free(face->fast);
+		glyph_map_clear(&face->glyphs, font_cached_glyph_free);
+		free_fallback_faces(face);
+		cache = face->cache;
+		pthread_mutex_destroy(&face->glyph_lock);
+		FT_Done_Face(face->ft);
+		free(face);
+		manager__unref();
+	}
+
+	manager_unlock();
+
+	/* writing the cache may block on the disk and the fallback may be a
+	 * face of this backend, so drop both unlocked */
+	kmscon_font_cache_free(cache);
+	kmscon_font_unref(fallback);
+}
+
+static int kmscon_font_freetype_init(struct kmscon_font *out,
+				     const struct kmscon_font_attr *attr)
+{
+	struct face *face = NULL;
+	int ret;
+
+	memcpy(&out->attr, attr, sizeof(*attr));
+	kmscon_font_attr_normalize(&out->attr);
+
+	log_debug("loading freetype font %s", out->attr.name);
+
+	ret = manager_get_face(&face, &out->attr);
+	if (ret)
+		return ret;
+	memcpy(&out->attr, &face->real_attr, sizeof(out->attr));
+	out->baseline = face->baseline;
+
+	out->data = face;
+	return 0;
+}
+
+static void kmscon_font_freetype_destroy(struct kmscon_font *font)
+{
+	struct face *face;
+
+	log_debug("unloading freetype font");
+	face = font->data;
+	manager_put_face(face);
+}
+
+static int kmscon_font_freetype_render(struct kmscon_font *font, uint32_t id,
+				       const uint32_t *ch, size_t len,
+				       const struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyph;
+	int ret;
+
+	ret = get_glyph(font->data, &glyph, id, ch, len, true);
+	if (ret)
+		return ret;
+
+	*out = glyph;
+	return 0;
+}
+
+static int kmscon_font_freetype_lookup(struct kmscon_font *font, uint32_t id,
+				       const uint32_t *ch, size_t len,
+				       const struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyph;
+	int ret;
+
+	ret = get_glyph(font->data, &glyph, id, ch, len, false);
+	if (ret)
+		return ret;
+
+	*out = glyph;
+	return 0;
+}
+
+static int kmscon_font_freetype_render_empty(struct kmscon_font *font,
+					     const struct kmscon_glyph **out)
+{
+	static const uint32_t empty_char = ' ';
+	return kmscon_font_freetype_render(font, empty_char, &empty_char, 1,
+					   out);
+}
+
+static int kmscon_font_freetype_render_inval(struct kmscon_font *font,
+					     const struct kmscon_glyph **out)
+{
+	static const uint32_t question_mark = '?';
+	return kmscon_font_freetype_render(font, question_mark,
+					   &question_mark, 1, out);
+}
+
+static void kmscon_font_freetype_get_stats(struct kmscon_font *font,
+					   struct kmscon_glyph_stats *stats)
+{
+	struct face *face = font->data;
+
+	pthread_mutex_lock(&face->glyph_lock);
+	stats->size = face->lru.size;
+	stats->limit = face->lru.limit;
+	stats->entries = face->lru.entries;
+	stats->hits = shl_lru_get_hits(&face->lru);
+	stats->misses = face->lru.misses;
+	stats->evictions = face->lru.evictions;
+	pthread_mutex_unlock(&face->glyph_lock);
+
+	kmscon_font_cache_get_fallback_stats(face->cache,
+					     &stats->fallback_hits,
+					     &stats->fallback_misses);
+}
+
+struct kmscon_font_ops kmscon_font_freetype_ops = {
+	.name = "freetype",
+	.owner = NULL,
+	.init = kmscon_font_freetype_init,
+	.destroy = kmscon_font_freetype_destroy,
+	.render = kmscon_font_freetype_render,
+	.lookup = kmscon_font_freetype_lookup,
+	.render_empty = kmscon_font_freetype_render_empty,
+	.render_inval = kmscon_font_freetype_render_inval,
+	.get_stats = kmscon_font_freetype_get_stats,
+};
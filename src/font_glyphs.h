@@ -0,0 +1,105 @@
+/*
+ * kmscon - Cached Glyph Table
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Cached Glyph Table
+ * The pango and freetype backends keep the rendered glyphs of each face in a
+ * hash table with LRU accounting and a lock-free array for the first
+ * KMSCON_GLYPH_FAST_NUM ids. The table, its lock and the lookup paths are part
+ * of each face; this header only holds the entries and the eviction they have
+ * in common.
+ *
+ * Glyphs with glyph->data set reference bitmaps owned by the persistent cache
+ * or the shared glyph store. Their bitmaps are neither freed here nor counted
+ * against the budget.
+ */
+
+#ifndef KMSCON_FONT_GLYPHS_H
+#define KMSCON_FONT_GLYPHS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "font.h"
+#include "shl_lru.h"
+#include "shl_u32map.h"
+
+struct cached_glyph {
+	struct shl_lru_entry lru;
+	uint32_t id;
+	struct kmscon_glyph *glyph;
+};
+
+SHL_U32MAP_DEFINE(glyph_map, struct cached_glyph)
+
+static inline void font_glyph_free(struct kmscon_glyph *glyph)
+{
+	if (!glyph->data)
+		free(glyph->buf.data);
+	free(glyph);
+}
+
+static inline void font_cached_glyph_free(struct cached_glyph *cg)
+{
+	font_glyph_free(cg->glyph);
+	free(cg);
+}
+
+static inline size_t font_glyph_size(const struct kmscon_glyph *glyph)
+{
+	size_t size = sizeof(struct cached_glyph) + sizeof(*glyph);
+
+	if (!glyph->data)
+		size += glyph->buf.stride * glyph->buf.height;
+	return size;
+}
+
+/* Evict least-recently-used glyphs of older frames until the table fits into
+ * the budget again. Lock-free lookups in @fast stop seeing evicted glyphs, but
+ * the caller must make sure none of them is still in use. Must be called with
+ * the lock of the table held. */
+static inline void font_glyphs_evict(struct glyph_map *glyphs,
+				     struct shl_lru *lru,
+				     struct cached_glyph **fast)
+{
+	struct shl_lru_entry *e;
+	struct cached_glyph *cg;
+	unsigned long epoch;
+
+	lru->limit = kmscon_font_get_cache_limit();
+	epoch = kmscon_font_get_epoch();
+
+	while ((e = shl_lru_victim(lru, epoch))) {
+		cg = shl_offsetof(e, struct cached_glyph, lru);
+		shl_lru_evict(lru, e);
+		if (cg->id < KMSCON_GLYPH_FAST_NUM)
+			__atomic_store_n(&fast[cg->id], NULL,
+					 __ATOMIC_RELEASE);
+		glyph_map_remove(glyphs, cg->id);
+		font_cached_glyph_free(cg);
+	}
+}
+
+#endif /* KMSCON_FONT_GLYPHS_H */
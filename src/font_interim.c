@@ -0,0 +1,458 @@
+/*
+ * kmscon - Interim Fonts
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * SECTION:font_interim.c
+ * @short_description: Interim fonts for zooming
+ * @include: font.h
+ *
+ * Rasterizing all glyphs of a screen in a new size takes long enough to stall
+ * zooming noticeably. kmscon_font_new_interim() wraps the font of the new size
+ * and serves every glyph that this font has not rasterized, yet, as a scaled
+ * copy of the glyph of the previous font. The real glyphs are requested via
+ * batches so font backends with worker threads rasterize them in the
+ * background.
+ *
+ * kmscon_font_interim_update() is called periodically by the owner. It counts
+ * the scaled glyphs whose real glyphs became ready and rasterizes a few of the
+ * remaining ones for backends without background rendering. Whenever glyphs
+ * became ready, the owner flushes the glyphs the text renderers copied so the
+ * next frame picks up the real glyphs. Once nothing is pending, the owner calls
+ * kmscon_font_interim_finish() and the interim font just forwards to the real
+ * font from then on.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "font.h"
+#include "shl_dlist.h"
+#include "shl_log.h"
+#include "shl_u32map.h"
+#include "uterm_video.h"
+
+#define LOG_SUBSYSTEM "font_interim"
+
+/* glyphs rasterized synchronously per kmscon_font_interim_update() call */
+#define INTERIM_BUDGET 16
+
+struct interim_glyph {
+	struct shl_dlist list;
+	uint32_t id;
+	struct kmscon_glyph glyph;
+	size_t len;
+	uint32_t *ch;
+	uint8_t data[];
+};
+
+SHL_U32MAP_DEFINE(interim_map, struct interim_glyph)
+
+struct interim_font {
+	struct kmscon_font *font;
+	struct kmscon_font *prev;
+	bool done;
+
+	pthread_mutex_t lock;
+	struct interim_map glyphs;
+	struct shl_dlist pending;
+};
+
+static uint8_t sample(const struct uterm_video_buffer *buf, unsigned int x,
+		      unsigned int y)
+{
+	const uint8_t *row = &buf->data[y * buf->stride];
+
+	if (buf->format == UTERM_FORMAT_MONO)
+		return (row[x / 8] & (0x80 >> (x % 8))) ? 0xff : 0x00;
+	return row[x];
+}
+
+/* Source position of the center of pixel @i of @dst pixels in 24.8 fixed point,
+ * shifted by half a pixel so the integer part is the left sample. */
+static unsigned int scale_pos(unsigned int i, unsigned int src,
+			      unsigned int dst)
+{
+	unsigned int pos;
+
+	pos = ((2 * i + 1) * src * 256) / (2 * dst);
+	return pos < 128 ? 0 : pos - 128;
+}
+
+/* bilinear scaling of @src into the 8-bit buffer @dst */
+static void scale_glyph(struct uterm_video_buffer *dst,
+			const struct uterm_video_buffer *src)
+{
+	unsigned int x, y, px, py, x0, x1, y0, y1, fx, fy, top, bottom;
+	uint8_t *row;
+
+	for (y = 0; y < dst->height; ++y) {
+		py = scale_pos(y, src->height, dst->height);
+		y0 = py >> 8;
+		y1 = y0 + 1 < src->height ? y0 + 1 : y0;
+		fy = py & 0xff;
+		row = &dst->data[y * dst->stride];
+
+		for (x = 0; x < dst->width; ++x) {
+			px = scale_pos(x, src->width, dst->width);
+			x0 = px >> 8;
+			x1 = x0 + 1 < src->width ? x0 + 1 : x0;
+			fx = px & 0xff;
+
+			top = sample(src, x0, y0) * (256 - fx) +
+			      sample(src, x1, y0) * fx;
+			bottom = sample(src, x0, y1) * (256 - fx) +
+				 sample(src, x1, y1) * fx;
+			row[x] = (top * (256 - fy) + bottom * fy) >> 16;
+		}
+	}
+}
+
+static struct interim_glyph *new_interim_glyph(struct interim_font *inf,
+					       uint32_t id, const uint32_t *ch,
+					       size_t len,
+					       const struct kmscon_glyph *src)
+{
+	struct interim_glyph *ig;
+	unsigned int width, height;
+	size_t size;
+
+	width = src->buf.width * inf->font->attr.width /
+		inf->prev->attr.width;
+	height = src->buf.height * inf->font->attr.height /
+		 inf->prev->attr.height;
+	size = (size_t)width * height;
+
+	ig = malloc(sizeof(*ig) + size + sizeof(uint32_t) * len);
+	if (!ig)
+		return NULL;
+
+	memset(ig, 0, sizeof(*ig));
+	ig->id = id;
+	ig->len = len;
+	ig->ch = (uint32_t*)&ig->data[size];
+	memcpy(ig->ch, ch, sizeof(uint32_t) * len);
+
+	ig->glyph.width = src->width;
+	ig->glyph.buf.width = width;
+	ig->glyph.buf.height = height;
+	ig->glyph.buf.stride = width;
+	ig->glyph.buf.format = UTERM_FORMAT_GREY;
+	ig->glyph.buf.data = ig->data;
+
+	if (src->buf.width && src->buf.height)
+		scale_glyph(&ig->glyph.buf, &src->buf);
+	else
+		memset(ig->data, 0, size);
+
+	kmscon_glyph_set_ink(&ig->glyph);
+	return ig;
+}
+
+static void free_interim_glyph(struct interim_glyph *ig)
+{
+	free(ig);
+}
+
+static int interim_render(struct kmscon_font *font,
+			  uint32_t id, const uint32_t *ch, size_t len,
+			  const struct kmscon_glyph **out)
+{
+	struct interim_font *inf = font->data;
+	const struct kmscon_glyph *glyph;
+	struct interim_glyph *ig;
+	int ret;
+
+	if (__atomic_load_n(&inf->done, __ATOMIC_ACQUIRE))
+		return kmscon_font_render(inf->font, id, ch, len, out);
+
+	ret = kmscon_font_lookup(inf->font, id, ch, len, out);
+	if (ret != -EAGAIN)
+		return ret;
+
+	pthread_mutex_lock(&inf->lock);
+
+	ig = interim_map_find(&inf->glyphs, id);
+	if (ig) {
+		*out = &ig->glyph;
+		goto out_unlock;
+	}
+
+	/* without a usable glyph to scale we have to wait for the real one */
+	ret = kmscon_font_render(inf->prev, id, ch, len, &glyph);
+	if (ret || (glyph->buf.format != UTERM_FORMAT_GREY &&
+		    glyph->buf.format != UTERM_FORMAT_MONO))
+		goto out_real;
+
+	ig = new_interim_glyph(inf, id, ch, len, glyph);
+	if (!ig)
+		goto out_real;
+
+	ret = interim_map_insert(&inf->glyphs, id, ig);
+	if (ret) {
+		free_interim_glyph(ig);
+		goto out_real;
+	}
+
+	shl_dlist_link_tail(&inf->pending, &ig->list);
+	*out = &ig->glyph;
+
+out_unlock:
+	pthread_mutex_unlock(&inf->lock);
+	return 0;
+
+out_real:
+	pthread_mutex_unlock(&inf->lock);
+	return kmscon_font_render(inf->font, id, ch, len, out);
+}
+
+static int interim_render_empty(struct kmscon_font *font,
+				const struct kmscon_glyph **out)
+{
+	struct interim_font *inf = font->data;
+
+	return kmscon_font_render_empty(inf->font, out);
+}
+
+static int interim_render_inval(struct kmscon_font *font,
+				const struct kmscon_glyph **out)
+{
+	struct interim_font *inf = font->data;
+
+	return kmscon_font_render_inval(inf->font, out);
+}
+
+static int interim_render_batch(struct kmscon_font *font,
+				const struct kmscon_font_req *reqs, size_t num)
+{
+	struct interim_font *inf = font->data;
+
+	return kmscon_font_render_batch(inf->font, reqs, num);
+}
+
+static void interim_get_stats(struct kmscon_font *font,
+			      struct kmscon_glyph_stats *stats)
+{
+	struct interim_font *inf = font->data;
+
+	kmscon_font_get_stats(inf->font, stats);
+}
+
+static void interim__drop(struct interim_font *inf)
+{
+	shl_dlist_init(&inf->pending);
+	interim_map_clear(&inf->glyphs, free_interim_glyph);
+	if (inf->prev) {
+		kmscon_font_unref(inf->prev);
+		inf->prev = NULL;
+	}
+}
+
+static void interim_destroy(struct kmscon_font *font)
+{
+	struct interim_font *inf = font->data;
+
+	interim__drop(inf);
+	pthread_mutex_destroy(&inf->lock);
+	kmscon_font_unref(inf->font);
+	free(inf);
+}
+
+static const struct kmscon_font_ops interim_ops = {
+	.name = "interim",
+	.owner = NULL,
+	.destroy = interim_destroy,
+	.render = interim_render,
+	.render_empty = interim_render_empty,
+	.render_inval = interim_render_inval,
+	.get_stats = interim_get_stats,
+};
+
+static const struct kmscon_font_ops interim_batch_ops = {
+	.name = "interim",
+	.owner = NULL,
+	.destroy = interim_destroy,
+	.render = interim_render,
+	.render_empty = interim_render_empty,
+	.render_inval = interim_render_inval,
+	.render_batch = interim_render_batch,
+	.get_stats = interim_get_stats,
+};
+
+static bool is_interim(struct kmscon_font *font)
+{
+	return font && (font->ops == &interim_ops ||
+			font->ops == &interim_batch_ops);
+}
+
+/**
+ * kmscon_font_new_interim:
+ * @out: A pointer to the new font is stored here
+ * @font: Font that is zoomed to
+ * @prev: Font that was used so far
+ *
+ * This creates a font with the metrics of @font that serves glyphs @font has
+ * not rasterized, yet, by scaling the glyphs of @prev. The new font takes a
+ * reference to both fonts; @prev is dropped by kmscon_font_interim_finish().
+ *
+ * Returns: 0 on success, negative error code on failure
+ */
+int kmscon_font_new_interim(struct kmscon_font **out, struct kmscon_font *font,
+			    struct kmscon_font *prev)
+{
+	struct kmscon_font *interim;
+	struct interim_font *inf;
+	int ret;
+
+	if (!out || !font || !prev)
+		return -EINVAL;
+
+	interim = malloc(sizeof(*interim));
+	if (!interim)
+		return -ENOMEM;
+	memset(interim, 0, sizeof(*interim));
+
+	inf = malloc(sizeof(*inf));
+	if (!inf) {
+		ret = -ENOMEM;
+		goto err_interim;
+	}
+	memset(inf, 0, sizeof(*inf));
+	interim_map_init(&inf->glyphs);
+	shl_dlist_init(&inf->pending);
+
+	ret = pthread_mutex_init(&inf->lock, NULL);
+	if (ret) {
+		ret = -ret;
+		goto err_inf;
+	}
+
+	inf->font = font;
+	kmscon_font_ref(font);
+	inf->prev = prev;
+	kmscon_font_ref(prev);
+
+	interim->ref = 1;
+	interim->ops = font->ops->render_batch ? &interim_batch_ops :
+						 &interim_ops;
+	interim->attr = font->attr;
+	interim->baseline = font->baseline;
+	interim->data = inf;
+
+	*out = interim;
+	return 0;
+
+err_inf:
+	free(inf);
+err_interim:
+	free(interim);
+	return ret;
+}
+
+/**
+ * kmscon_font_interim_update:
+ * @font: Interim font
+ * @ready: Number of scaled glyphs whose real glyphs became ready is stored here
+ *
+ * This checks which of the scaled glyphs handed out so far can be replaced by
+ * the real glyphs. A few glyphs that are still missing are rasterized
+ * synchronously, so this also makes progress for backends that cannot render
+ * in the background. If @ready is non-zero, the caller must flush the glyphs of
+ * all text renderers that use @font via kmscon_text_flush().
+ *
+ * Returns: Number of scaled glyphs that are still pending, negative error code
+ * on failure
+ */
+int kmscon_font_interim_update(struct kmscon_font *font, unsigned int *ready)
+{
+	struct interim_font *inf;
+	struct interim_glyph *ig;
+	const struct kmscon_glyph *glyph;
+	struct shl_dlist *iter, *tmp;
+	unsigned int budget = INTERIM_BUDGET;
+	int ret, num = 0;
+
+	if (!is_interim(font) || !ready)
+		return -EINVAL;
+
+	inf = font->data;
+	*ready = 0;
+
+	pthread_mutex_lock(&inf->lock);
+
+	shl_dlist_for_each_safe(iter, tmp, &inf->pending) {
+		ig = shl_dlist_entry(iter, struct interim_glyph, list);
+
+		ret = kmscon_font_lookup(inf->font, ig->id, ig->ch, ig->len,
+					 &glyph);
+		if (ret == -EAGAIN && budget) {
+			--budget;
+			ret = kmscon_font_render(inf->font, ig->id, ig->ch,
+						 ig->len, &glyph);
+		}
+
+		/* errors are final, too; the renderers get them directly */
+		if (ret == -EAGAIN) {
+			++num;
+		} else {
+			shl_dlist_unlink(&ig->list);
+			++*ready;
+		}
+	}
+
+	pthread_mutex_unlock(&inf->lock);
+
+	return num;
+}
+
+/**
+ * kmscon_font_interim_finish:
+ * @font: Interim font
+ *
+ * This frees all scaled glyphs and drops the previous font. From now on @font
+ * forwards everything to the real font. The text renderers must not use any
+ * glyph of @font anymore that was returned before this call, so call
+ * kmscon_text_flush() first if kmscon_font_interim_update() reported glyphs as
+ * ready since the last flush.
+ */
+void kmscon_font_interim_finish(struct kmscon_font *font)
+{
+	struct interim_font *inf;
+
+	if (!is_interim(font))
+		return;
+
+	inf = font->data;
+
+	pthread_mutex_lock(&inf->lock);
+	if (!inf->done) {
+		log_debug("interim font replaced %zu glyphs", inf->glyphs.num);
+		__atomic_store_n(&inf->done, true, __ATOMIC_RELEASE);
+		interim__drop(inf);
+	}
+	pthread_mutex_unlock(&inf->lock);
+}
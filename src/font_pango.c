@@ -30,8 +30,9 @@
  * @include: font.h
  *
  * The pango backend uses pango and freetype2 to render glyphs into memory
- * buffers. It uses a hashmap to cache all rendered glyphs of a single
- * font-face. Therefore, rendering should be very fast. Also, when loading a
+ * buffers. It uses a hashmap to cache the recently used glyphs of a single
+ * font-face, bounded by the glyph cache budget. Therefore, rendering should be
+ * very fast. Also, when loading a
  * glyph it pre-renders all common (mostly ASCII) characters, so it can measure
  * the font and return a valid font hight/width.
  *
@@ -41,6 +42,23 @@
  * italic/bold fonts correctly and more.
  * However, this also means it pulls in a lot of dependencies including glib,
  * pango, freetype2 and more.
+ *
+ * Each face has its own font-map and context which are protected by a per-face
+ * render lock, so different faces never block each other. Additionally, glyph
+ * batches can be passed to a small pool of worker threads. Each worker has its
+ * own font-map and context per face so workers can rasterize in parallel. The
+ * rendering thread only blocks on glyphs it actually needs and picks up queued
+ * jobs itself if no worker has started them, yet.
+ *
+ * The first miss of a code-point in a script or block usually means that more
+ * code-points of it are about to be drawn. So on this miss, the rest of the
+ * block is queued as low-priority jobs which at most one worker processes at a
+ * time and only while no regular jobs are queued.
+ *
+ * Glyphs with small ids are additionally published in a flat array which the
+ * rendering thread reads without taking any lock. Workers only ever add glyphs,
+ * eviction is done exclusively by the rendering thread, so a glyph cannot be
+ * freed while it is looked up locklessly.
  */
 
 #include <errno.h>
@@ -52,14 +70,32 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "font.h"
+#include "font_cache.h"
+#include "font_glyphs.h"
+#include "font_width.h"
 #include "shl_dlist.h"
-#include "shl_hashtable.h"
 #include "shl_log.h"
+#include "shl_lru.h"
+#include "shl_u32map.h"
 #include "uterm_video.h"
 
 #define LOG_SUBSYSTEM "font_pango"
 
+#define POOL_MAX 8
+
+/* code-points are prefetched in aligned chunks of 128 unless their script is
+ * listed in prefetch_blocks */
+#define PREFETCH_SHIFT 7
+#define PREFETCH_BITS (sizeof(unsigned long) * 8)
+#define PREFETCH_WORDS \
+	((KMSCON_WIDTH_MAX >> PREFETCH_SHIFT) / PREFETCH_BITS + 1)
+
+struct job;
+
+SHL_U32MAP_DEFINE(job_map, struct job)
+
 struct face {
 	unsigned long ref;
 	struct shl_dlist list;
@@ -67,16 +103,78 @@ struct face {
 	struct kmscon_font_attr attr;
 	struct kmscon_font_attr real_attr;
 	unsigned int baseline;
+	PangoFontDescription *desc;
+	PangoFontMap *map;
 	PangoContext *ctx;
+	pthread_mutex_t render_lock;
+
 	pthread_mutex_t glyph_lock;
-	struct shl_hashtable *glyphs;
+	pthread_cond_t glyph_cond;
+	struct glyph_map glyphs;
+	struct job_map pending;
+	struct shl_lru lru;
+	struct cached_glyph **fast;
+	struct kmscon_font_cache *cache;
+	unsigned long prefetched[PREFETCH_WORDS];
+
+	/* @running is protected by pool.lock; each worker context is only
+	 * accessed by its worker or after all workers left the face */
+	unsigned long running;
+	PangoFontMap *worker_map[POOL_MAX];
+	PangoContext *worker_ctx[POOL_MAX];
+};
+
+struct job {
+	struct shl_dlist list;
+	struct face *face;
+	bool queued;
+	bool idle;
+	uint32_t id;
+	size_t len;
+	uint32_t ch[];
+};
+
+struct pool {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	pthread_cond_t done_cond;
+	struct shl_dlist jobs;
+	struct shl_dlist idle;
+	bool idle_busy;
+	bool stop;
+	unsigned int num;
+	pthread_t threads[POOL_MAX];
 };
 
 static pthread_mutex_t manager_mutex = PTHREAD_MUTEX_INITIALIZER;
 static unsigned long manager__refcnt;
-static PangoFontMap *manager__lib;
 static struct shl_dlist manager__list = SHL_DLIST_INIT(manager__list);
 
+static struct pool pool = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+	.done_cond = PTHREAD_COND_INITIALIZER,
+	.jobs = SHL_DLIST_INIT(pool.jobs),
+	.idle = SHL_DLIST_INIT(pool.idle),
+};
+
+static const struct prefetch_block {
+	uint32_t first;
+	uint32_t last;
+} prefetch_blocks[] = {
+	{ 0x0080, 0x00ff },	/* Latin-1 Supplement */
+	{ 0x0100, 0x024f },	/* Latin Extended-A and -B */
+	{ 0x0370, 0x03ff },	/* Greek and Coptic */
+	{ 0x0400, 0x04ff },	/* Cyrillic */
+	{ 0x0530, 0x058f },	/* Armenian */
+	{ 0x0590, 0x05ff },	/* Hebrew */
+	{ 0x10a0, 0x10ff },	/* Georgian */
+	{ 0x2000, 0x206f },	/* General Punctuation */
+	{ 0x2190, 0x21ff },	/* Arrows */
+	{ 0x2200, 0x22ff },	/* Mathematical Operators */
+	{ 0x3000, 0x30ff },	/* CJK Symbols, Hiragana and Katakana */
+};
+
 static void manager_lock()
 {
 	pthread_mutex_lock(&manager_mutex);
@@ -87,32 +185,70 @@ static void manager_unlock()
 	pthread_mutex_unlock(&manager_mutex);
 }
 
+static void pool__start(void);
+static void pool__stop(void);
+
 static int manager__ref()
 {
-	if (!manager__refcnt++) {
-		manager__lib = pango_ft2_font_map_new();
-		if (!manager__lib) {
-			log_warn("cannot create font map");
-			--manager__refcnt;
-			return -EFAULT;
-		}
-	}
+	if (!manager__refcnt++)
+		pool__start();
 
 	return 0;
 }
 
 static void manager__unref()
 {
-	if (!--manager__refcnt) {
-		g_object_unref(manager__lib);
-		manager__lib = NULL;
+	if (!--manager__refcnt)
+		pool__stop();
+}
+
+static PangoContext *create_context(struct face *face, PangoFontMap **map)
+{
+	PangoContext *ctx;
+
+	*map = pango_ft2_font_map_new();
+	if (!*map) {
+		log_warn("cannot create font map");
+		return NULL;
 	}
+
+	ctx = pango_font_map_create_context(*map);
+	if (!ctx) {
+		g_object_unref(*map);
+		*map = NULL;
+		return NULL;
+	}
+
+	pango_context_set_base_dir(ctx, PANGO_DIRECTION_LTR);
+	pango_context_set_language(ctx, pango_language_get_default());
+	pango_context_set_font_description(ctx, face->desc);
+
+	return ctx;
 }
 
-static int get_glyph(struct face *face, struct kmscon_glyph **out,
-		     uint32_t id, const uint32_t *ch, size_t len)
+/* Look up glyph @id and mark it as used in the current frame. Must be called
+ * with glyph_lock held. */
+static struct kmscon_glyph *face__find_glyph(struct face *face, uint32_t id)
+{
+	struct cached_glyph *cg;
+
+	cg = glyph_map_find(&face->glyphs, id);
+	if (!cg)
+		return NULL;
+
+	shl_lru_touch(&face->lru, &cg->lru, kmscon_font_get_epoch());
+	return cg->glyph;
+}
+
+/* Rasterize a single glyph with the given context, unless it is available in
+ * the persistent cache. No face locks are taken. */
+static int render_glyph(struct face *face, PangoContext *ctx,
+			struct kmscon_glyph **out, const uint32_t *ch,
+			size_t len)
 {
 	struct kmscon_glyph *glyph;
+	struct kmscon_font_fallback fb;
+	PangoFontDescription *desc;
 	PangoLayout *layout;
 	PangoRectangle rec;
 	PangoLayoutLine *line;
@@ -120,36 +256,24 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 	unsigned int cwidth;
 	size_t ulen, cnt;
 	char *val;
-	bool res;
 	int ret;
 
-	if (!len)
-		return -ERANGE;
-	cwidth = tsm_ucs4_get_width(*ch);
+	cwidth = kmscon_ucs4_get_width(*ch);
 	if (!cwidth)
 		return -ERANGE;
 
-	pthread_mutex_lock(&face->glyph_lock);
-	res = shl_hashtable_find(face->glyphs, (void**)&glyph,
-				 (void*)(long)id);
-	pthread_mutex_unlock(&face->glyph_lock);
-	if (res) {
-		*out = glyph;
+	if (!kmscon_font_cache_find(face->cache, out, ch, len))
 		return 0;
-	}
-
-	manager_lock();
 
 	glyph = malloc(sizeof(*glyph));
 	if (!glyph) {
 		log_error("cannot allocate memory for new glyph");
-		ret = -ENOMEM;
-		goto out_unlock;
+		return -ENOMEM;
 	}
 	memset(glyph, 0, sizeof(*glyph));
 	glyph->width = cwidth;
 
-	layout = pango_layout_new(face->ctx);
+	layout = pango_layout_new(ctx);
 
 	/* render one line only */
 	pango_layout_set_height(layout, 0);
@@ -157,6 +281,18 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 	/* no line spacing */
 	pango_layout_set_spacing(layout, 0);
 
+	/* Use the cached fallback face directly so pango does not run
+	 * fontconfig fallback resolution for each missing code-point. */
+	if (len == 1 && !kmscon_font_cache_covers(face->cache, *ch) &&
+	    !kmscon_font_cache_get_fallback(face->cache, *ch, &fb)) {
+		desc = pango_font_description_copy(face->desc);
+		if (desc) {
+			pango_font_description_set_family(desc, fb.family);
+			pango_layout_set_font_description(layout, desc);
+			pango_font_description_free(desc);
+		}
+	}
+
 	val = tsm_ucs4_to_utf8_alloc(ch, len, &ulen);
 	if (!val) {
 		ret = -ERANGE;
@@ -200,46 +336,448 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 	bitmap.buffer = glyph->buf.data;
 
 	pango_ft2_render_layout_line(&bitmap, line, -rec.x, face->baseline);
+	kmscon_glyph_set_ink(glyph);
+
+	g_object_unref(layout);
+	kmscon_font_cache_add(face->cache, ch, len, &glyph);
+	*out = glyph;
+	return 0;
+
+out_glyph:
+	free(glyph);
+	g_object_unref(layout);
+	return ret;
+}
+
+/* Add @glyph to the glyph table. If another thread was faster, @glyph is freed
+ * and the existing glyph is returned. Must be called with glyph_lock held. */
+static struct kmscon_glyph *face__add_glyph(struct face *face, uint32_t id,
+					    struct kmscon_glyph *glyph)
+{
+	struct kmscon_glyph *g;
+	struct cached_glyph *cg;
+	int ret;
+
+	g = face__find_glyph(face, id);
+	if (g) {
+		font_glyph_free(glyph);
+		return g;
+	}
+
+	cg = malloc(sizeof(*cg));
+	if (!cg) {
+		font_glyph_free(glyph);
+		return NULL;
+	}
+	cg->id = id;
+	cg->glyph = glyph;
+
+	ret = glyph_map_insert(&face->glyphs, id, cg);
+	if (ret) {
+		log_error("cannot add glyph to glyph table");
+		font_cached_glyph_free(cg);
+		return NULL;
+	}
+
+	shl_lru_add(&face->lru, &cg->lru, font_glyph_size(glyph),
+		    kmscon_font_get_epoch());
+	if (id < KMSCON_GLYPH_FAST_NUM)
+		__atomic_store_n(&face->fast[id], cg, __ATOMIC_RELEASE);
 
+	return glyph;
+}
+
+static void *pool_worker(void *data)
+{
+	unsigned int idx = (unsigned long)data;
+	struct job *job;
+	struct face *face;
+	struct kmscon_glyph *glyph;
+	PangoContext *ctx;
+	bool idle;
+	int ret;
+
+	pthread_mutex_lock(&pool.lock);
+	while (true) {
+		while (!pool.stop && shl_dlist_empty(&pool.jobs) &&
+		       (pool.idle_busy || shl_dlist_empty(&pool.idle)))
+			pthread_cond_wait(&pool.cond, &pool.lock);
+		if (pool.stop)
+			break;
+
+		idle = shl_dlist_empty(&pool.jobs);
+		if (idle) {
+			job = shl_dlist_entry(pool.idle.next, struct job, list);
+			pool.idle_busy = true;
+		} else {
+			job = shl_dlist_entry(pool.jobs.next, struct job, list);
+		}
+		shl_dlist_unlink(&job->list);
+		job->queued = false;
+		face = job->face;
+		++face->running;
+
+		/* The worker context is only used by this worker and the face
+		 * cannot go away while @running is non-zero. */
+		ctx = face->worker_ctx[idx];
+		pthread_mutex_unlock(&pool.lock);
+
+		if (!ctx) {
+			ctx = create_context(face, &face->worker_map[idx]);
+			face->worker_ctx[idx] = ctx;
+		}
+
+		if (ctx)
+			ret = render_glyph(face, ctx, &glyph, job->ch,
+					   job->len);
+		else
+			ret = -EFAULT;
+
+		pthread_mutex_lock(&face->glyph_lock);
+		if (!ret)
+			face__add_glyph(face, job->id, glyph);
+		job_map_remove(&face->pending, job->id);
+		pthread_cond_broadcast(&face->glyph_cond);
+		pthread_mutex_unlock(&face->glyph_lock);
+
+		free(job);
+
+		pthread_mutex_lock(&pool.lock);
+		if (idle)
+			pool.idle_busy = false;
+		--face->running;
+		pthread_cond_broadcast(&pool.done_cond);
+	}
+	pthread_mutex_unlock(&pool.lock);
+
+	return NULL;
+}
+
+static void pool__start(void)
+{
+	long cpus;
+	unsigned int i;
+	int ret;
+
+	/* the rendering thread helps out, so one worker less than CPUs */
+	cpus = sysconf(_SC_NPROCESSORS_ONLN) - 1;
+	if (cpus <= 0)
+		return;
+	if (cpus > POOL_MAX)
+		cpus = POOL_MAX;
+
+	pool.stop = false;
+	for (i = 0; i < cpus; ++i) {
+		ret = pthread_create(&pool.threads[i], NULL, pool_worker,
+				     (void*)(unsigned long)i);
+		if (ret) {
+			log_warning("cannot create glyph worker thread (%d)",
+				    ret);
+			break;
+		}
+	}
+
+	pool.num = i;
+	log_debug("using %u glyph worker threads", pool.num);
+}
+
+static void pool__stop(void)
+{
+	unsigned int i;
+
+	if (!pool.num)
+		return;
+
+	pthread_mutex_lock(&pool.lock);
+	pool.stop = true;
+	pthread_cond_broadcast(&pool.cond);
+	pthread_mutex_unlock(&pool.lock);
+
+	for (i = 0; i < pool.num; ++i)
+		pthread_join(pool.threads[i], NULL);
+	pool.num = 0;
+}
+
+static void pool__cancel_list(struct face *face, struct shl_dlist *list)
+{
+	struct shl_dlist *iter, *tmp;
+	struct job *job;
+
+	shl_dlist_for_each_safe(iter, tmp, list) {
+		job = shl_dlist_entry(iter, struct job, list);
+		if (job->face != face)
+			continue;
+
+		shl_dlist_unlink(&job->list);
+		job_map_remove(&face->pending, job->id);
+		free(job);
+	}
+}
+
+/* Remove all queued jobs of @face and wait for running jobs to finish. Must be
+ * called before the face is destroyed. Lock order is glyph_lock > pool.lock. */
+static void pool_cancel(struct face *face)
+{
 	pthread_mutex_lock(&face->glyph_lock);
-	ret = shl_hashtable_insert(face->glyphs, (void*)(long)id, glyph);
+	pthread_mutex_lock(&pool.lock);
+
+	pool__cancel_list(face, &pool.jobs);
+	pool__cancel_list(face, &pool.idle);
+
 	pthread_mutex_unlock(&face->glyph_lock);
-	if (ret) {
-		log_error("cannot add glyph to hashtable");
-		goto out_buffer;
+
+	/* running workers need glyph_lock to finish, so it must be dropped */
+	while (face->running)
+		pthread_cond_wait(&pool.done_cond, &pool.lock);
+
+	pthread_mutex_unlock(&pool.lock);
+}
+
+static void prefetch_range(uint32_t ch, uint32_t *first, uint32_t *last)
+{
+	size_t i, num;
+
+	num = sizeof(prefetch_blocks) / sizeof(*prefetch_blocks);
+	for (i = 0; i < num; ++i) {
+		if (ch >= prefetch_blocks[i].first &&
+		    ch <= prefetch_blocks[i].last) {
+			*first = prefetch_blocks[i].first;
+			*last = prefetch_blocks[i].last;
+			return;
+		}
+	}
+
+	*first = ch & ~((1U << PREFETCH_SHIFT) - 1);
+	*last = *first + (1U << PREFETCH_SHIFT) - 1;
+}
+
+/* Queue all missing code-points of the block of @ch as idle jobs, unless this
+ * block was prefetched before. The block is only marked once all its jobs are
+ * queued, so it is retried if an allocation fails. Must be called with
+ * glyph_lock held. */
+static void face__prefetch(struct face *face, uint32_t ch)
+{
+	struct shl_dlist list;
+	struct job *job;
+	uint32_t first, last, c, bit;
+	bool done = true, failed = false;
+	unsigned int num = 0;
+
+	if (!pool.num || ch >= KMSCON_WIDTH_MAX)
+		return;
+
+	prefetch_range(ch, &first, &last);
+	if (last >= KMSCON_WIDTH_MAX)
+		last = KMSCON_WIDTH_MAX - 1;
+
+	for (c = first >> PREFETCH_SHIFT; c <= last >> PREFETCH_SHIFT; ++c) {
+		bit = c % PREFETCH_BITS;
+		if (!(face->prefetched[c / PREFETCH_BITS] & (1UL << bit)))
+			done = false;
+	}
+	if (done)
+		return;
+
+	shl_dlist_init(&list);
+	for (c = first; c <= last; ++c) {
+		/* box glyphs are drawn by the font core, not by us */
+		if (c == ch || !kmscon_ucs4_get_width(c) ||
+		    kmscon_font_box_covers(c))
+			continue;
+		if (glyph_map_find(&face->glyphs, c) ||
+		    job_map_find(&face->pending, c))
+			continue;
+
+		job = malloc(sizeof(*job) + sizeof(uint32_t));
+		if (!job) {
+			failed = true;
+			break;
+		}
+		memset(job, 0, sizeof(*job));
+		job->face = face;
+		job->queued = true;
+		job->idle = true;
+		job->id = c;
+		job->len = 1;
+		job->ch[0] = c;
+
+		if (job_map_insert(&face->pending, c, job)) {
+			free(job);
+			failed = true;
+			break;
+		}
+
+		shl_dlist_link_tail(&list, &job->list);
+		++num;
+	}
+
+	if (!failed) {
+		for (c = first >> PREFETCH_SHIFT; c <= last >> PREFETCH_SHIFT;
+		     ++c) {
+			bit = c % PREFETCH_BITS;
+			face->prefetched[c / PREFETCH_BITS] |= 1UL << bit;
+		}
+	}
+
+	if (shl_dlist_empty(&list))
+		return;
+
+	pthread_mutex_lock(&pool.lock);
+	while (!shl_dlist_empty(&list)) {
+		job = shl_dlist_entry(list.next, struct job, list);
+		shl_dlist_unlink(&job->list);
+		shl_dlist_link_tail(&pool.idle, &job->list);
+	}
+	pthread_cond_broadcast(&pool.cond);
+	pthread_mutex_unlock(&pool.lock);
+
+	log_debug("prefetching %u glyphs of block U+%04X-U+%04X",
+		  num, first, last);
+}
+
+static int get_glyph(struct face *face, struct kmscon_glyph **out,
+		     uint32_t id, const uint32_t *ch, size_t len)
+{
+	struct kmscon_glyph *glyph;
+	struct cached_glyph *cg;
+	struct job *job;
+	int ret;
+
+	if (id < KMSCON_GLYPH_FAST_NUM) {
+		cg = __atomic_load_n(&face->fast[id], __ATOMIC_ACQUIRE);
+		if (cg) {
+			shl_lru_mark(&face->lru, &cg->lru,
+				     kmscon_font_get_epoch());
+			*out = cg->glyph;
+			return 0;
+		}
+	}
+
+	if (!len)
+		return -ERANGE;
+	if (!kmscon_ucs4_get_width(*ch))
+		return -ERANGE;
+
+	pthread_mutex_lock(&face->glyph_lock);
+	while (true) {
+		glyph = face__find_glyph(face, id);
+		if (glyph) {
+			pthread_mutex_unlock(&face->glyph_lock);
+			*out = glyph;
+			return 0;
+		}
+
+		job = job_map_find(&face->pending, id);
+		if (!job)
+			break;
+
+		/* If no worker picked up the job, yet, we render it ourself
+		 * instead of waiting for all jobs queued before it. */
+		pthread_mutex_lock(&pool.lock);
+		if (job->queued) {
+			shl_dlist_unlink(&job->list);
+			job_map_remove(&face->pending, id);
+			free(job);
+			pthread_mutex_unlock(&pool.lock);
+			break;
+		}
+		pthread_mutex_unlock(&pool.lock);
+
+		/* A worker renders it right now. Wait for it and recheck. If
+		 * the worker failed, we retry it ourself below. */
+		pthread_cond_wait(&face->glyph_cond, &face->glyph_lock);
 	}
+	if (len == 1)
+		face__prefetch(face, *ch);
+	pthread_mutex_unlock(&face->glyph_lock);
+
+	pthread_mutex_lock(&face->render_lock);
+	ret = render_glyph(face, face->ctx, &glyph, ch, len);
+	pthread_mutex_unlock(&face->render_lock);
+	if (ret)
+		return ret;
+
+	pthread_mutex_lock(&face->glyph_lock);
+	glyph = face__add_glyph(face, id, glyph);
+	font_glyphs_evict(&face->glyphs, &face->lru, face->fast);
+	pthread_mutex_unlock(&face->glyph_lock);
+	if (!glyph)
+		return -ENOMEM;
 
 	*out = glyph;
-	goto out_layout;
+	return 0;
+}
 
-out_buffer:
-	free(glyph->buf.data);
-out_glyph:
-	free(glyph);
-out_layout:
-	g_object_unref(layout);
-out_unlock:
-	manager_unlock();
+/* Same as get_glyph() but never rasterizes; returns -EAGAIN instead. */
+static int peek_glyph(struct face *face, struct kmscon_glyph **out,
+		      uint32_t id, const uint32_t *ch, size_t len)
+{
+	struct kmscon_glyph *glyph;
+	struct cached_glyph *cg;
+	int ret = 0;
+
+	if (id < KMSCON_GLYPH_FAST_NUM) {
+		cg = __atomic_load_n(&face->fast[id], __ATOMIC_ACQUIRE);
+		if (cg) {
+			shl_lru_mark(&face->lru, &cg->lru,
+				     kmscon_font_get_epoch());
+			*out = cg->glyph;
+			return 0;
+		}
+	}
+
+	if (!len)
+		return -ERANGE;
+	if (!kmscon_ucs4_get_width(*ch))
+		return -ERANGE;
+
+	pthread_mutex_lock(&face->glyph_lock);
+	glyph = face__find_glyph(face, id);
+	if (!glyph && !job_map_find(&face->pending, id) &&
+	    !kmscon_font_cache_find(face->cache, &glyph, ch, len)) {
+		glyph = face__add_glyph(face, id, glyph);
+		font_glyphs_evict(&face->glyphs, &face->lru, face->fast);
+		if (!glyph)
+			ret = -ENOMEM;
+	} else if (!glyph) {
+		ret = -EAGAIN;
+	}
+	pthread_mutex_unlock(&face->glyph_lock);
+
+	if (!ret)
+		*out = glyph;
 	return ret;
 }
 
-static void free_glyph(void *data)
+static void measure_face(struct face *face)
 {
-	struct kmscon_glyph *glyph = data;
+	PangoLayout *layout;
+	PangoRectangle rec;
+	const char *str;
+	int num;
 
-	free(glyph->buf.data);
-	free(glyph);
+	layout = pango_layout_new(face->ctx);
+	pango_layout_set_height(layout, 0);
+	pango_layout_set_spacing(layout, 0);
+	str = "abcdefghijklmnopqrstuvwxyz"
+	      "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+	      "@!\"$%&/()=?\\}][{°^~+*#'<>|-_.:,;`´";
+	num = strlen(str);
+	pango_layout_set_text(layout, str, num);
+	pango_layout_get_pixel_extents(layout, NULL, &rec);
+
+	face->real_attr.height = rec.height;
+	face->real_attr.width = rec.width / num + 1;
+	face->baseline = PANGO_PIXELS_CEIL(pango_layout_get_baseline(layout));
+	g_object_unref(layout);
 }
 
 static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 {
 	struct shl_dlist *iter;
 	struct face *face, *f;
-	PangoFontDescription *desc;
-	PangoLayout *layout;
-	PangoRectangle rec;
-	int ret, num;
-	const char *str;
+	struct kmscon_font_cache *cache = NULL;
+	int ret;
 
 	manager_lock();
 
@@ -266,6 +804,7 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 	memset(face, 0, sizeof(*face));
 	face->ref = 1;
 	memcpy(&face->attr, attr, sizeof(*attr));
+	shl_lru_init(&face->lru, kmscon_font_get_cache_limit());
 
 	ret = pthread_mutex_init(&face->glyph_lock, NULL);
 	if (ret) {
@@ -273,46 +812,49 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 		goto err_free;
 	}
 
-	ret = shl_hashtable_new(&face->glyphs, shl_direct_hash,
-				shl_direct_equal, NULL, free_glyph);
+	ret = pthread_mutex_init(&face->render_lock, NULL);
 	if (ret) {
-		log_error("cannot allocate hashtable");
+		log_error("cannot initialize render lock");
 		goto err_lock;
 	}
 
-	face->ctx = pango_font_map_create_context(manager__lib);
-	pango_context_set_base_dir(face->ctx, PANGO_DIRECTION_LTR);
-	pango_context_set_language(face->ctx, pango_language_get_default());
+	ret = pthread_cond_init(&face->glyph_cond, NULL);
+	if (ret) {
+		log_error("cannot initialize glyph condition");
+		goto err_render_lock;
+	}
+
+	face->fast = calloc(KMSCON_GLYPH_FAST_NUM, sizeof(*face->fast));
+	if (!face->fast) {
+		log_error("cannot allocate glyph array");
+		ret = -ENOMEM;
+		goto err_cond;
+	}
 
-	desc = pango_font_description_from_string(attr->name);
-	pango_font_description_set_absolute_size(desc,
+	face->desc = pango_font_description_from_string(attr->name);
+	pango_font_description_set_absolute_size(face->desc,
 					PANGO_SCALE * face->attr.height);
-	pango_font_description_set_weight(desc,
+	pango_font_description_set_weight(face->desc,
 			attr->bold ? PANGO_WEIGHT_BOLD : PANGO_WEIGHT_NORMAL);
-	pango_font_description_set_style(desc,
+	pango_font_description_set_style(face->desc,
 			attr->italic ? PANGO_STYLE_ITALIC : PANGO_STYLE_NORMAL);
-	pango_font_description_set_variant(desc, PANGO_VARIANT_NORMAL);
-	pango_font_description_set_stretch(desc, PANGO_STRETCH_NORMAL);
-	pango_font_description_set_gravity(desc, PANGO_GRAVITY_SOUTH);
-	pango_context_set_font_description(face->ctx, desc);
-	pango_font_description_free(desc);
+	pango_font_description_set_variant(face->desc, PANGO_VARIANT_NORMAL);
+	pango_font_description_set_stretch(face->desc, PANGO_STRETCH_NORMAL);
+	pango_font_description_set_gravity(face->desc, PANGO_GRAVITY_SOUTH);
 
-	/* measure font */
-	layout = pango_layout_new(face->ctx);
-	pango_layout_set_height(layout, 0);
-	pango_layout_set_spacing(layout, 0);
-	str = "abcdefghijklmnopqrstuvwxyz"
-	      "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-	      "@!\"$%&/()=?\\}][{°^~+*#'<>|-_.:,;`´";
-	num = strlen(str);
-	pango_layout_set_text(layout, str, num);
-	pango_layout_get_pixel_extents(layout, NULL, &rec);
+	face->ctx = create_context(face, &face->map);
+	if (!face->ctx) {
+		ret = -EFAULT;
+		goto err_desc;
+	}
+
+	/* the cache is optional so errors are ignored */
+	kmscon_font_cache_new(&face->cache, "pango", NULL, attr);
 
 	memcpy(&face->real_attr, &face->attr, sizeof(face->attr));
-	face->real_attr.height = rec.height;
-	face->real_attr.width = rec.width / num + 1;
-	face->baseline = PANGO_PIXELS_CEIL(pango_layout_get_baseline(layout));
-	g_object_unref(layout);
+	if (!kmscon_font_cache_get_metrics(face->cache, &face->real_attr,
+					   &face->baseline))
+		measure_face(face);
 
 	kmscon_font_attr_normalize(&face->real_attr);
 	if (!face->real_attr.height || !face->real_attr.width) {
@@ -321,6 +863,9 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 		goto err_face;
 	}
 
+	kmscon_font_cache_set_metrics(face->cache, &face->real_attr,
+				      face->baseline);
+
 	/* The real metrics probably differ from the requested metrics so try
 	 * again to find a suitable cached font. */
 	shl_dlist_for_each(iter, &manager__list) {
@@ -339,8 +884,16 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 	goto out_unlock;
 
 err_face:
+	cache = face->cache;
 	g_object_unref(face->ctx);
-	shl_hashtable_free(face->glyphs);
+	g_object_unref(face->map);
+err_desc:
+	pango_font_description_free(face->desc);
+	free(face->fast);
+err_cond:
+	pthread_cond_destroy(&face->glyph_cond);
+err_render_lock:
+	pthread_mutex_destroy(&face->render_lock);
 err_lock:
 	pthread_mutex_destroy(&face->glyph_lock);
 err_free:
@@ -349,23 +902,51 @@ err_manager:
 	manager__unref();
 out_unlock:
 	manager_unlock();
+	/* writing the cache may block on the disk, so do it unlocked */
+	kmscon_font_cache_free(cache);
 	return ret;
 }
 
 static void manager_put_face(struct face *face)
 {
+	struct kmscon_font_cache *cache = NULL;
+	unsigned int i;
+
 	manager_lock();
 
 	if (!--face->ref) {
 		shl_dlist_unlink(&face->list);
-		shl_hashtable_free(face->glyphs);
+		pool_cancel(face);
+
+		for (i = 0; i < POOL_MAX; ++i) {
+			if (face->worker_ctx[i])
+				g_object_unref(face->worker_ctx[i]);
+			if (face->worker_map[i])
+				g_object_unref(face->worker_map[i]);
+		}
+
+		log_debug("glyph cache: %lu glyphs, %zu bytes, %lu evictions",
+			  face->lru.entries, face->lru.size,
+			  face->lru.evictions);
+
+		free(face->fast);
+		job_map_clear(&face->pending, NULL);
+		glyph_map_clear(&face->glyphs, font_cached_glyph_free);
+		cache = face->cache;
+		pthread_cond_destroy(&face->glyph_cond);
+		pthread_mutex_destroy(&face->render_lock);
 		pthread_mutex_destroy(&face->glyph_lock);
 		g_object_unref(face->ctx);
+		g_object_unref(face->map);
+		pango_font_description_free(face->desc);
 		free(face);
 		manager__unref();
 	}
 
 	manager_unlock();
+
+	/* writing the cache may block on the disk */
+	kmscon_font_cache_free(cache);
 }
 
 static int kmscon_font_pango_init(struct kmscon_font *out,
@@ -413,6 +994,21 @@ static int kmscon_font_pango_render(struct kmscon_font *font, uint32_t id,
 	return 0;
 }
 
+static int kmscon_font_pango_lookup(struct kmscon_font *font, uint32_t id,
+				    const uint32_t *ch, size_t len,
+				    const struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyph;
+	int ret;
+
+	ret = peek_glyph(font->data, &glyph, id, ch, len);
+	if (ret)
+		return ret;
+
+	*out = glyph;
+	return 0;
+}
+
 static int kmscon_font_pango_render_empty(struct kmscon_font *font,
 					  const struct kmscon_glyph **out)
 {
@@ -428,12 +1024,117 @@ static int kmscon_font_pango_render_inval(struct kmscon_font *font,
 					out);
 }
 
+static int kmscon_font_pango_render_batch(struct kmscon_font *font,
+					  const struct kmscon_font_req *reqs,
+					  size_t num)
+{
+	struct face *face = font->data;
+	struct kmscon_glyph *glyph;
+	struct shl_dlist list;
+	struct job *job;
+	size_t i;
+	int ret = 0;
+
+	if (!pool.num)
+		return 0;
+
+	shl_dlist_init(&list);
+
+	pthread_mutex_lock(&face->glyph_lock);
+	for (i = 0; i < num; ++i) {
+		if (!reqs[i].len || !kmscon_ucs4_get_width(*reqs[i].ch))
+			continue;
+		/* touch cached glyphs so they survive until drawn */
+		if (face__find_glyph(face, reqs[i].id))
+			continue;
+		job = job_map_find(&face->pending, reqs[i].id);
+		if (job) {
+			/* a prefetched glyph is needed now, promote it */
+			pthread_mutex_lock(&pool.lock);
+			if (job->queued && job->idle) {
+				shl_dlist_unlink(&job->list);
+				job->idle = false;
+				shl_dlist_link_tail(&list, &job->list);
+			}
+			pthread_mutex_unlock(&pool.lock);
+			continue;
+		}
+		if (!kmscon_font_cache_find(face->cache, &glyph, reqs[i].ch,
+					    reqs[i].len)) {
+			face__add_glyph(face, reqs[i].id, glyph);
+			continue;
+		}
+
+		job = malloc(sizeof(*job) + sizeof(uint32_t) * reqs[i].len);
+		if (!job) {
+			ret = -ENOMEM;
+			break;
+		}
+		memset(job, 0, sizeof(*job));
+		job->face = face;
+		job->queued = true;
+		job->id = reqs[i].id;
+		job->len = reqs[i].len;
+		memcpy(job->ch, reqs[i].ch, sizeof(uint32_t) * reqs[i].len);
+
+		ret = job_map_insert(&face->pending, job->id, job);
+		if (ret) {
+			free(job);
+			break;
+		}
+
+		shl_dlist_link_tail(&list, &job->list);
+		if (job->len == 1)
+			face__prefetch(face, job->ch[0]);
+	}
+
+	font_glyphs_evict(&face->glyphs, &face->lru, face->fast);
+
+	/* Hand the jobs over while still holding glyph_lock, so nobody can
+	 * find a pending job that is not queued, yet. */
+	if (!shl_dlist_empty(&list)) {
+		pthread_mutex_lock(&pool.lock);
+		while (!shl_dlist_empty(&list)) {
+			job = shl_dlist_entry(list.next, struct job, list);
+			shl_dlist_unlink(&job->list);
+			shl_dlist_link_tail(&pool.jobs, &job->list);
+		}
+		pthread_cond_broadcast(&pool.cond);
+		pthread_mutex_unlock(&pool.lock);
+	}
+	pthread_mutex_unlock(&face->glyph_lock);
+
+	return ret;
+}
+
+static void kmscon_font_pango_get_stats(struct kmscon_font *font,
+					struct kmscon_glyph_stats *stats)
+{
+	struct face *face = font->data;
+
+	pthread_mutex_lock(&face->glyph_lock);
+	stats->size = face->lru.size;
+	stats->limit = face->lru.limit;
+	stats->entries = face->lru.entries;
+	stats->hits = shl_lru_get_hits(&face->lru);
+	stats->misses = face->lru.misses;
+	stats->evictions = face->lru.evictions;
+	pthread_mutex_unlock(&face->glyph_lock);
+
+	kmscon_font_cache_get_fallback_stats(face->cache,
+					     &stats->fallback_hits,
+					     &stats->fallback_misses);
+}
+
 struct kmscon_font_ops kmscon_font_pango_ops = {
 	.name = "pango",
 	.owner = NULL,
 	.init = kmscon_font_pango_init,
 	.destroy = kmscon_font_pango_destroy,
 	.render = kmscon_font_pango_render,
+	.lookup = kmscon_font_pango_lookup,
 	.render_empty = kmscon_font_pango_render_empty,
 	.render_inval = kmscon_font_pango_render_inval,
+	.render_batch = kmscon_font_pango_render_batch,
+	.get_stats = kmscon_font_pango_get_stats,
 };
@@ -0,0 +1,926 @@
+/*
+ * kmscon - PSF and BDF console fonts
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * SECTION:font_psf.c
+ * @short_description: PSF and BDF console fonts
+ * @include: font.h
+ *
+ * This backend loads the bitmap fonts used by the linux console (PSF1 and
+ * PSF2, as found in /usr/share/consolefonts) and X11 BDF fonts. Neither
+ * fontconfig nor any rasterizer is needed.
+ *
+ * The font name is either a path or a file name which is searched for in the
+ * usual console font directories, with or without extension. It may contain
+ * glob(7) wildcards like "ter-v*n", in which case the file whose height is
+ * closest to the requested size is used. This allows zooming through all
+ * sizes a font family ships.
+ *
+ * PSF files are mapped into memory and the glyph bitmaps are used directly from
+ * the mapping as UTERM_FORMAT_MONO buffers. Gzip compressed files are inflated
+ * into memory once. BDF glyphs come with their own bounding boxes, so they are
+ * converted into cell-sized bitmaps while loading. In all cases the unicode
+ * table is parsed once into a map from code-points to glyphs, which is never
+ * modified afterwards so lookups do not lock. Loaded files are shared between
+ * all fonts using them.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <glob.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "font.h"
+#include "shl_dlist.h"
+#include "shl_log.h"
+#include "shl_u32map.h"
+#include "uterm_video.h"
+
+#ifdef BUILD_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#define LOG_SUBSYSTEM "font_psf"
+
+#define PSF1_MAGIC0 0x36
+#define PSF1_MAGIC1 0x04
+#define PSF1_MODE512 0x01
+#define PSF1_MODEHASTAB 0x02
+#define PSF1_MODEHASSEQ 0x04
+#define PSF1_SEPARATOR 0xffff
+#define PSF1_STARTSEQ 0xfffe
+
+#define PSF2_MAGIC "\x72\xb5\x4a\x86"
+#define PSF2_HEADER_SIZE 32
+#define PSF2_HAS_UNICODE_TABLE 0x01
+#define PSF2_SEPARATOR 0xff
+#define PSF2_STARTSEQ 0xfe
+
+/* decompressed bytes that are enough to find the size of any font file */
+#define PSF_PROBE_SIZE 4096
+#define PSF_MAX_GLYPHS 0x110000
+#define PSF_MAX_SIZE 256
+
+static const char *psf_dirs[] = {
+	"/usr/share/consolefonts",
+	"/usr/share/kbd/consolefonts",
+	"/usr/lib/kbd/consolefonts",
+	"/usr/share/fonts/misc",
+	NULL,
+};
+
+static const char *psf_exts[] = {
+	"",
+	".psfu.gz",
+	".psf.gz",
+	".psfu",
+	".psf",
+	".bdf.gz",
+	".bdf",
+	NULL,
+};
+
+SHL_U32MAP_DEFINE(glyph_map, struct kmscon_glyph)
+
+struct psf_info {
+	unsigned int width;
+	unsigned int height;
+	unsigned int baseline;
+};
+
+struct psf_file {
+	struct shl_dlist list;
+	unsigned long ref;
+	char *path;
+
+	uint8_t *data;
+	size_t size;
+	bool mapped;
+	uint8_t *bitmaps;
+	size_t bitmaps_size;
+
+	struct psf_info info;
+	size_t num;
+	struct kmscon_glyph *glyphs;
+	struct glyph_map map;
+
+	/* statistics are best-effort only */
+	unsigned long hits;
+	unsigned long misses;
+};
+
+static pthread_mutex_t psf_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct shl_dlist psf_files = SHL_DLIST_INIT(psf_files);
+
+static uint32_t get_le32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+#ifdef BUILD_HAVE_ZLIB
+
+/* Inflate at most @limit bytes (0 for no limit) of the gzip data @in. */
+static int gunzip(const uint8_t *in, size_t in_size, size_t limit,
+		  uint8_t **out, size_t *out_size)
+{
+	z_stream zs;
+	uint8_t *buf = NULL, *tmp;
+	size_t len = 0, cap = 0;
+	int ret;
+
+	if (in_size > UINT_MAX)
+		return -EFBIG;
+
+	memset(&zs, 0, sizeof(zs));
+	if (inflateInit2(&zs, 16 + MAX_WBITS) != Z_OK)
+		return -ENOMEM;
+
+	zs.next_in = (Bytef*)in;
+	zs.avail_in = in_size;
+	while (true) {
+		if (len == cap) {
+			if (limit && cap >= limit)
+				break;
+			cap = cap ? cap * 2 : in_size * 4 + 4096;
+			if (limit && cap > limit)
+				cap = limit;
+			tmp = realloc(buf, cap);
+			if (!tmp) {
+				ret = -ENOMEM;
+				goto err_free;
+			}
+			buf = tmp;
+		}
+
+		zs.next_out = &buf[len];
+		zs.avail_out = cap - len;
+		ret = inflate(&zs, Z_NO_FLUSH);
+		len = cap - zs.avail_out;
+		if (ret == Z_STREAM_END)
+			break;
+		if (ret != Z_OK) {
+			ret = -EINVAL;
+			goto err_free;
+		}
+	}
+
+	inflateEnd(&zs);
+	*out = buf;
+	*out_size = len;
+	return 0;
+
+err_free:
+	inflateEnd(&zs);
+	free(buf);
+	return ret;
+}
+
+#endif /* BUILD_HAVE_ZLIB */
+
+static void file_release(uint8_t *data, size_t size, bool mapped)
+{
+	if (mapped)
+		munmap(data, size);
+	else
+		free(data);
+}
+
+/* Map @path into memory. Compressed files are inflated instead, up to @limit
+ * bytes if it is not 0. */
+static int file_read(const char *path, size_t limit, uint8_t **out,
+		     size_t *size, bool *mapped)
+{
+	struct stat st;
+	uint8_t *data;
+	int fd, ret;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return -errno;
+
+	ret = fstat(fd, &st);
+	if (ret) {
+		ret = -errno;
+		goto err_close;
+	}
+	if (!S_ISREG(st.st_mode) || st.st_size < 4) {
+		ret = -EINVAL;
+		goto err_close;
+	}
+
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED) {
+		ret = -errno;
+		goto err_close;
+	}
+	close(fd);
+
+	if (data[0] != 0x1f || data[1] != 0x8b) {
+		*out = data;
+		*size = st.st_size;
+		*mapped = true;
+		return 0;
+	}
+
+#ifdef BUILD_HAVE_ZLIB
+	ret = gunzip(data, st.st_size, limit, out, size);
+	*mapped = false;
+	if (ret)
+		log_warning("cannot inflate font %s (%d)", path, ret);
+#else
+	log_warning("cannot load compressed font %s, no zlib support", path);
+	ret = -EOPNOTSUPP;
+#endif
+
+	munmap(data, st.st_size);
+	return ret;
+
+err_close:
+	close(fd);
+	return ret;
+}
+
+/*
+ * PSF
+ * Both versions store the glyphs as 1-bpp bitmaps with rows padded to full
+ * bytes, followed by an optional unicode table that lists the code-points of
+ * each glyph in order. Sequences of combining characters start with a special
+ * marker and are ignored here. Fonts without unicode table are indexed by
+ * code-point directly.
+ */
+
+static bool psf1_probe(const uint8_t *data, size_t size,
+		       struct psf_info *info)
+{
+	if (size < 4 || data[0] != PSF1_MAGIC0 || data[1] != PSF1_MAGIC1)
+		return false;
+	if (!data[3])
+		return false;
+
+	info->width = 8;
+	info->height = data[3];
+	return true;
+}
+
+static bool psf2_probe(const uint8_t *data, size_t size,
+		       struct psf_info *info)
+{
+	uint32_t width, height;
+
+	if (size < PSF2_HEADER_SIZE || memcmp(data, PSF2_MAGIC, 4))
+		return false;
+
+	height = get_le32(&data[24]);
+	width = get_le32(&data[28]);
+	if (!width || !height || width > PSF_MAX_SIZE || height > PSF_MAX_SIZE)
+		return false;
+
+	info->width = width;
+	info->height = height;
+	return true;
+}
+
+static void psf_add(struct psf_file *file, uint32_t ch, size_t idx)
+{
+	if (ch >= PSF_MAX_GLYPHS)
+		return;
+
+	/* code-points listed twice keep their first glyph */
+	glyph_map_insert(&file->map, ch, &file->glyphs[idx]);
+}
+
+static const uint8_t *psf1_table(struct psf_file *file, const uint8_t *p,
+				 const uint8_t *end, size_t idx)
+{
+	uint32_t ch;
+	bool seq = false;
+
+	for ( ; end - p >= 2; p += 2) {
+		ch = p[0] | (p[1] << 8);
+		if (ch == PSF1_SEPARATOR)
+			return p + 2;
+		if (ch == PSF1_STARTSEQ)
+			seq = true;
+		else if (!seq)
+			psf_add(file, ch, idx);
+	}
+
+	return end;
+}
+
+static bool utf8_decode(const uint8_t **pos, const uint8_t *end,
+			uint32_t *out)
+{
+	const uint8_t *p = *pos;
+	uint32_t ch;
+	unsigned int i, num;
+
+	if (*p < 0x80) {
+		ch = *p;
+		num = 0;
+	} else if ((*p & 0xe0) == 0xc0) {
+		ch = *p & 0x1f;
+		num = 1;
+	} else if ((*p & 0xf0) == 0xe0) {
+		ch = *p & 0x0f;
+		num = 2;
+	} else if ((*p & 0xf8) == 0xf0) {
+		ch = *p & 0x07;
+		num = 3;
+	} else {
+		*pos = p + 1;
+		return false;
+	}
+
+	++p;
+	for (i = 0; i < num; ++i, ++p) {
+		if (p >= end || (*p & 0xc0) != 0x80) {
+			*pos = p;
+			return false;
+		}
+		ch = (ch << 6) | (*p & 0x3f);
+	}
+
+	*pos = p;
+	*out = ch;
+	return true;
+}
+
+static const uint8_t *psf2_table(struct psf_file *file, const uint8_t *p,
+				 const uint8_t *end, size_t idx)
+{
+	uint32_t ch;
+	bool seq = false;
+
+	while (p < end) {
+		if (*p == PSF2_SEPARATOR)
+			return p + 1;
+		if (*p == PSF2_STARTSEQ) {
+			seq = true;
+			++p;
+			continue;
+		}
+		if (utf8_decode(&p, end, &ch) && !seq)
+			psf_add(file, ch, idx);
+	}
+
+	return end;
+}
+
+static int psf_load(struct psf_file *file)
+{
+	const uint8_t *data = file->data, *p, *end;
+	size_t offset, charsize, num, i;
+	bool psf2, table;
+	unsigned int stride;
+
+	psf2 = psf2_probe(data, file->size, &file->info);
+	if (psf2) {
+		offset = get_le32(&data[8]);
+		table = get_le32(&data[12]) & PSF2_HAS_UNICODE_TABLE;
+		num = get_le32(&data[16]);
+		charsize = get_le32(&data[20]);
+	} else if (psf1_probe(data, file->size, &file->info)) {
+		offset = 4;
+		table = data[2] & (PSF1_MODEHASTAB | PSF1_MODEHASSEQ);
+		num = (data[2] & PSF1_MODE512) ? 512 : 256;
+		charsize = data[3];
+	} else {
+		return -EINVAL;
+	}
+
+	stride = (file->info.width + 7) / 8;
+	if (psf2 && offset < PSF2_HEADER_SIZE)
+		return -EINVAL;
+	if (charsize < stride * file->info.height || !num ||
+	    num > PSF_MAX_GLYPHS || offset > file->size ||
+	    (file->size - offset) / charsize < num)
+		return -EINVAL;
+
+	file->info.baseline = file->info.height / 4;
+	file->num = num;
+	file->glyphs = calloc(num, sizeof(*file->glyphs));
+	if (!file->glyphs)
+		return -ENOMEM;
+
+	for (i = 0; i < num; ++i) {
+		file->glyphs[i].width = 1;
+		file->glyphs[i].buf.width = file->info.width;
+		file->glyphs[i].buf.height = file->info.height;
+		file->glyphs[i].buf.stride = stride;
+		file->glyphs[i].buf.format = UTERM_FORMAT_MONO;
+		file->glyphs[i].buf.data = (uint8_t*)&data[offset +
+							     i * charsize];
+		kmscon_glyph_set_ink(&file->glyphs[i]);
+	}
+
+	if (!table) {
+		for (i = 0; i < num; ++i)
+			psf_add(file, i, i);
+		return 0;
+	}
+
+	p = &data[offset + num * charsize];
+	end = &data[file->size];
+	for (i = 0; i < num && p < end; ++i) {
+		if (psf2)
+			p = psf2_table(file, p, end, i);
+		else
+			p = psf1_table(file, p, end, i);
+	}
+
+	return 0;
+}
+
+/*
+ * BDF
+ * BDF is a line based text format. Each glyph has its own bounding box
+ * relative to the origin on the baseline, so glyphs are copied into bitmaps of
+ * the size of a cell while loading. Glyphs that advance by more than one cell
+ * are treated as double-width glyphs.
+ */
+
+static bool bdf_line(const uint8_t **pos, const uint8_t *end, char *line,
+		     size_t max)
+{
+	const uint8_t *p = *pos;
+	size_t len = 0;
+
+	if (p >= end)
+		return false;
+
+	while (p < end && *p != '\n') {
+		if (len + 1 < max && *p != '\r')
+			line[len++] = *p;
+		++p;
+	}
+	line[len] = 0;
+
+	*pos = p < end ? p + 1 : p;
+	return true;
+}
+
+static bool bdf_keyword(const char *line, const char *key)
+{
+	size_t len = strlen(key);
+
+	return !strncmp(line, key, len) && (!line[len] || line[len] == ' ');
+}
+
+static int hexval(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+struct bdf_bbx {
+	int w;
+	int h;
+	int x;
+	int y;
+};
+
+static bool bdf_probe(const uint8_t *data, size_t size, struct psf_info *info,
+		      struct bdf_bbx *font_bbx)
+{
+	const uint8_t *p = data, *end = &data[size];
+	char line[256];
+	struct bdf_bbx bbx;
+	int ascent = -1, descent = -1;
+	bool has_bbx = false;
+
+	if (!bdf_line(&p, end, line, sizeof(line)) ||
+	    !bdf_keyword(line, "STARTFONT"))
+		return false;
+
+	while (bdf_line(&p, end, line, sizeof(line))) {
+		if (bdf_keyword(line, "FONTBOUNDINGBOX")) {
+			if (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d",
+				   &bbx.w, &bbx.h, &bbx.x, &bbx.y) == 4)
+				has_bbx = true;
+		} else if (bdf_keyword(line, "FONT_ASCENT")) {
+			sscanf(line, "FONT_ASCENT %d", &ascent);
+		} else if (bdf_keyword(line, "FONT_DESCENT")) {
+			sscanf(line, "FONT_DESCENT %d", &descent);
+		} else if (bdf_keyword(line, "CHARS") ||
+			   bdf_keyword(line, "STARTCHAR")) {
+			break;
+		}
+	}
+
+	if (!has_bbx)
+		return false;
+	if (ascent < 0 || descent < 0) {
+		ascent = bbx.h + bbx.y;
+		descent = -bbx.y;
+	}
+	if (bbx.w <= 0 || bbx.w > PSF_MAX_SIZE || ascent + descent <= 0 ||
+	    ascent + descent > PSF_MAX_SIZE || descent < 0)
+		return false;
+
+	info->width = bbx.w;
+	info->height = ascent + descent;
+	info->baseline = descent;
+	if (font_bbx)
+		*font_bbx = bbx;
+	return true;
+}
+
+/* copy the BITMAP rows following @p into the cell bitmap of @glyph */
+static const uint8_t *bdf_bitmap(struct psf_file *file,
+				 struct kmscon_glyph *glyph,
+				 const struct bdf_bbx *font_bbx,
+				 const struct bdf_bbx *bbx,
+				 const uint8_t *p, const uint8_t *end)
+{
+	char line[256];
+	int row, col, x, y, v;
+	unsigned int ascent;
+
+	ascent = file->info.height - file->info.baseline;
+	for (row = 0; row < bbx->h; ++row) {
+		if (!bdf_line(&p, end, line, sizeof(line)))
+			break;
+
+		y = ascent - (bbx->y + bbx->h) + row;
+		if (y < 0 || y >= (int)glyph->buf.height)
+			continue;
+
+		for (col = 0; col < bbx->w && line[col / 4]; ++col) {
+			v = hexval(line[col / 4]);
+			if (v < 0)
+				break;
+			if (!(v & (8 >> (col % 4))))
+				continue;
+
+			x = bbx->x - font_bbx->x + col;
+			if (x < 0 || x >= (int)glyph->buf.width)
+				continue;
+			glyph->buf.data[y * glyph->buf.stride + x / 8] |=
+							0x80 >> (x % 8);
+		}
+	}
+
+	return p;
+}
+
+static int bdf_load(struct psf_file *file)
+{
+	const uint8_t *p, *end = &file->data[file->size];
+	struct kmscon_glyph *glyph;
+	struct bdf_bbx font_bbx, bbx;
+	char line[256];
+	size_t num = 0, gsize, i = 0;
+	unsigned int stride;
+	long enc = -1;
+	int dwidth = 0;
+
+	if (!bdf_probe(file->data, file->size, &file->info, &font_bbx))
+		return -EINVAL;
+
+	p = file->data;
+	while (bdf_line(&p, end, line, sizeof(line))) {
+		if (bdf_keyword(line, "STARTCHAR"))
+			++num;
+	}
+	if (!num || num > PSF_MAX_GLYPHS)
+		return -EINVAL;
+
+	/* reserve room for double-width glyphs everywhere */
+	stride = (file->info.width * 2 + 7) / 8;
+	gsize = stride * file->info.height;
+	file->glyphs = calloc(num, sizeof(*file->glyphs));
+	file->bitmaps = calloc(num, gsize);
+	if (!file->glyphs || !file->bitmaps)
+		return -ENOMEM;
+	file->bitmaps_size = num * gsize;
+
+	bbx = font_bbx;
+	p = file->data;
+	while (i < num && bdf_line(&p, end, line, sizeof(line))) {
+		if (bdf_keyword(line, "STARTCHAR")) {
+			enc = -1;
+			dwidth = font_bbx.w;
+			bbx = font_bbx;
+		} else if (bdf_keyword(line, "ENCODING")) {
+			sscanf(line, "ENCODING %ld", &enc);
+		} else if (bdf_keyword(line, "DWIDTH")) {
+			sscanf(line, "DWIDTH %d", &dwidth);
+		} else if (bdf_keyword(line, "BBX")) {
+			sscanf(line, "BBX %d %d %d %d",
+			       &bbx.w, &bbx.h, &bbx.x, &bbx.y);
+		} else if (bdf_keyword(line, "BITMAP")) {
+			glyph = &file->glyphs[i];
+			glyph->width = dwidth > font_bbx.w ? 2 : 1;
+			glyph->buf.width = glyph->width * file->info.width;
+			glyph->buf.height = file->info.height;
+			glyph->buf.stride = (glyph->buf.width + 7) / 8;
+			glyph->buf.format = UTERM_FORMAT_MONO;
+			glyph->buf.data = &file->bitmaps[i * gsize];
+			p = bdf_bitmap(file, glyph, &font_bbx, &bbx, p, end);
+			kmscon_glyph_set_ink(glyph);
+
+			if (enc >= 0)
+				psf_add(file, enc, i);
+			++i;
+		}
+	}
+
+	file->num = i;
+
+	/* the glyphs were copied, so the file itself is no longer needed */
+	file_release(file->data, file->size, file->mapped);
+	file->data = NULL;
+	return 0;
+}
+
+static bool file_probe(const char *path, struct psf_info *info)
+{
+	uint8_t *data;
+	size_t size;
+	bool mapped, ret;
+
+	if (file_read(path, PSF_PROBE_SIZE, &data, &size, &mapped))
+		return false;
+
+	ret = psf2_probe(data, size, info) || psf1_probe(data, size, info) ||
+	      bdf_probe(data, size, info, NULL);
+
+	file_release(data, size, mapped);
+	return ret;
+}
+
+static void file_free(struct psf_file *file)
+{
+	glyph_map_clear(&file->map, NULL);
+	free(file->glyphs);
+	free(file->bitmaps);
+	if (file->data)
+		file_release(file->data, file->size, file->mapped);
+	free(file->path);
+	free(file);
+}
+
+/* must be called with psf_lock held */
+static int file__get(struct psf_file **out, const char *path)
+{
+	struct shl_dlist *iter;
+	struct psf_file *file;
+	int ret;
+
+	shl_dlist_for_each(iter, &psf_files) {
+		file = shl_dlist_entry(iter, struct psf_file, list);
+		if (!strcmp(file->path, path)) {
+			++file->ref;
+			*out = file;
+			return 0;
+		}
+	}
+
+	file = calloc(1, sizeof(*file));
+	if (!file)
+		return -ENOMEM;
+	file->ref = 1;
+
+	file->path = strdup(path);
+	if (!file->path) {
+		ret = -ENOMEM;
+		goto err_free;
+	}
+
+	ret = file_read(path, 0, &file->data, &file->size, &file->mapped);
+	if (ret)
+		goto err_free;
+
+	ret = psf_load(file);
+	if (ret == -EINVAL)
+		ret = bdf_load(file);
+	if (ret) {
+		log_warning("invalid console font %s (%d)", path, ret);
+		goto err_free;
+	}
+
+	log_debug("loaded %s: %ux%u, %zu glyphs, %zu code-points",
+		  path, file->info.width, file->info.height, file->num,
+		  file->map.num);
+	shl_dlist_link(&psf_files, &file->list);
+	*out = file;
+	return 0;
+
+err_free:
+	file_free(file);
+	return ret;
+}
+
+static void file_put(struct psf_file *file)
+{
+	pthread_mutex_lock(&psf_lock);
+	if (!--file->ref) {
+		shl_dlist_unlink(&file->list);
+		file_free(file);
+	}
+	pthread_mutex_unlock(&psf_lock);
+}
+
+/* A candidate is better if its height is closer to @height without exceeding
+ * it. If all candidates are too big, the smallest one is used. */
+static bool better_height(unsigned int cand, unsigned int best,
+			  unsigned int height)
+{
+	if (!best)
+		return true;
+	if (!height)
+		return false;
+	if (cand <= height)
+		return best > height || cand > best;
+	return best > height && cand < best;
+}
+
+static int find_file(const char *name, unsigned int height, char *out,
+		     size_t max)
+{
+	char pattern[PATH_MAX];
+	struct psf_info info;
+	unsigned int best = 0;
+	unsigned int i, j;
+	size_t k;
+	glob_t gl;
+	int r;
+
+	for (i = 0; psf_dirs[i]; ++i) {
+		for (j = 0; psf_exts[j]; ++j) {
+			if (strchr(name, '/'))
+				r = snprintf(pattern, sizeof(pattern), "%s%s",
+					     name, psf_exts[j]);
+			else
+				r = snprintf(pattern, sizeof(pattern),
+					     "%s/%s%s", psf_dirs[i], name,
+					     psf_exts[j]);
+			if (r < 0 || r >= (int)sizeof(pattern))
+				continue;
+			if (glob(pattern, 0, NULL, &gl))
+				continue;
+
+			for (k = 0; k < gl.gl_pathc; ++k) {
+				if (!file_probe(gl.gl_pathv[k], &info))
+					continue;
+				if (!better_height(info.height, best, height))
+					continue;
+				if (strlen(gl.gl_pathv[k]) >= max)
+					continue;
+
+				best = info.height;
+				strcpy(out, gl.gl_pathv[k]);
+			}
+			globfree(&gl);
+		}
+
+		/* paths are not searched for in the font directories */
+		if (strchr(name, '/'))
+			break;
+	}
+
+	return best ? 0 : -ENOENT;
+}
+
+static int kmscon_font_psf_init(struct kmscon_font *out,
+				const struct kmscon_font_attr *attr)
+{
+	struct psf_file *file;
+	char path[PATH_MAX];
+	int ret;
+
+	ret = find_file(attr->name, attr->height, path, sizeof(path));
+	if (ret) {
+		log_debug("no console font matches %s", attr->name);
+		return ret;
+	}
+
+	log_debug("loading console font %s", path);
+
+	pthread_mutex_lock(&psf_lock);
+	ret = file__get(&file, path);
+	pthread_mutex_unlock(&psf_lock);
+	if (ret)
+		return ret;
+
+	memcpy(&out->attr, attr, sizeof(*attr));
+	out->attr.bold = false;
+	out->attr.italic = false;
+	out->attr.width = file->info.width;
+	out->attr.height = file->info.height;
+	kmscon_font_attr_normalize(&out->attr);
+	out->baseline = file->info.baseline;
+	out->data = file;
+
+	return 0;
+}
+
+static void kmscon_font_psf_destroy(struct kmscon_font *font)
+{
+	struct psf_file *file = font->data;
+
+	log_debug("unloading console font %s", file->path);
+	file_put(file);
+}
+
+static int find_glyph(struct psf_file *file, uint32_t ch,
+		      const struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyph;
+
+	glyph = glyph_map_find(&file->map, ch);
+	if (!glyph) {
+		++file->misses;
+		return -ERANGE;
+	}
+
+	++file->hits;
+	*out = glyph;
+	return 0;
+}
+
+static int kmscon_font_psf_render(struct kmscon_font *font, uint32_t id,
+				  const uint32_t *ch, size_t len,
+				  const struct kmscon_glyph **out)
+{
+	if (len != 1)
+		return -ERANGE;
+
+	return find_glyph(font->data, *ch, out);
+}
+
+static int kmscon_font_psf_render_inval(struct kmscon_font *font,
+					const struct kmscon_glyph **out)
+{
+	if (!find_glyph(font->data, 0xfffd, out))
+		return 0;
+
+	return find_glyph(font->data, '?', out);
+}
+
+static int kmscon_font_psf_render_empty(struct kmscon_font *font,
+					const struct kmscon_glyph **out)
+{
+	return find_glyph(font->data, ' ', out);
+}
+
+static void kmscon_font_psf_get_stats(struct kmscon_font *font,
+				      struct kmscon_glyph_stats *stats)
+{
+	struct psf_file *file = font->data;
+
+	memset(stats, 0, sizeof(*stats));
+	stats->size = file->num * sizeof(struct kmscon_glyph) +
+		      file->bitmaps_size;
+	if (file->map.slots)
+		stats->size += sizeof(struct glyph_map_slot) << file->map.bits;
+	stats->entries = file->map.num;
+	stats->hits = file->hits;
+	stats->misses = file->misses;
+}
+
+struct kmscon_font_ops kmscon_font_psf_ops = {
+	.name = "psf",
+	.owner = NULL,
+	.init = kmscon_font_psf_init,
+	.destroy = kmscon_font_psf_destroy,
+	.render = kmscon_font_psf_render,
+	.render_empty = kmscon_font_psf_render_empty,
+	.render_inval = kmscon_font_psf_render_inval,
+	.get_stats = kmscon_font_psf_get_stats,
+};
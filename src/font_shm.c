@@ -0,0 +1,437 @@
+/*
+ * kmscon - Shared Glyph Store
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Shared Glyph Store
+ * The store has a fixed size. It starts with a header, followed by an
+ * open-addressing table of slots and the bitmap area. The object is created
+ * sparse, so only pages that are actually used consume memory.
+ *
+ * Each slot has a 64bit state word with the code-point in the upper and the
+ * slot status in the lower half. A writer claims an empty slot with a single
+ * compare-and-swap, allocates bitmap space by atomically bumping the
+ * allocation offset and publishes the slot with a release-store once the
+ * bitmap is written. Readers only use slots that are marked ready. Slots
+ * stuck in the writing state (for instance if a process crashed) are treated
+ * as misses. Nothing is ever removed; if the store is full, glyphs are simply
+ * kept private by the backends.
+ *
+ * Other processes may write the store concurrently, so all offsets and sizes
+ * read from it are checked against the mapping.
+ *
+ * Each user keeps the object open with a shared flock() for as long as it maps
+ * it. The last user to detach gets an exclusive lock and unlinks the object,
+ * so it does not outlive the processes that use it. As the kernel drops the
+ * locks of crashed processes, a store they left behind is unlinked by the next
+ * process that detaches from the same key.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include "font.h"
+#include "font_shm.h"
+#include "shl_log.h"
+
+#define LOG_SUBSYSTEM "font_shm"
+
+#define SHM_MAGIC 0x4d53474b
+#define SHM_VERSION 1
+#define SHM_SLOTS 16384
+#define SHM_PROBES 32
+#define SHM_RETRIES 4
+#define SHM_DATA_SIZE (16 * 1024 * 1024)
+#define SHM_MAX_DIM 1024
+
+enum slot_status {
+	SLOT_EMPTY,
+	SLOT_WRITING,
+	SLOT_READY,
+	SLOT_FAILED,
+};
+
+struct shm_header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t slots;
+	uint32_t data_offset;
+	uint32_t data_size;
+	uint32_t used;
+};
+
+struct shm_slot {
+	uint64_t state;
+	uint32_t cwidth;
+	uint32_t width;
+	uint32_t height;
+	uint32_t offset;
+};
+
+struct kmscon_font_shm {
+	int fd;
+	char name[64];
+	uint8_t *map;
+	size_t size;
+	struct shm_header *header;
+	struct shm_slot *slots;
+};
+
+#define SHM_SIZE (sizeof(struct shm_header) + \
+		  sizeof(struct shm_slot) * SHM_SLOTS + SHM_DATA_SIZE)
+
+static inline uint64_t slot_state(uint32_t ch, enum slot_status status)
+{
+	return ((uint64_t)ch << 32) | status;
+}
+
+static inline struct shm_slot *get_slot(struct kmscon_font_shm *shm,
+					uint32_t ch, unsigned int probe)
+{
+	uint32_t hash = ch * 2654435761U;
+
+	return &shm->slots[(hash + probe) % SHM_SLOTS];
+}
+
+static bool header_valid(const struct shm_header *h, uint64_t key)
+{
+	return h->magic == SHM_MAGIC && h->version == SHM_VERSION &&
+	       h->key == key && h->slots == SHM_SLOTS &&
+	       h->data_offset == sizeof(*h) + sizeof(struct shm_slot) *
+							SHM_SLOTS &&
+	       h->data_size == SHM_DATA_SIZE;
+}
+
+/**
+ * kmscon_font_shm_new:
+ * @out: The new store is stored here
+ * @key: Key that identifies the font face and rendering parameters
+ *
+ * Opens or creates the shared store for @key. The store can be disabled by
+ * setting KMSCON_FONT_SHM=0 in the environment. It is unlinked again when its
+ * last user frees it.
+ *
+ * Returns: 0 on success, negative error code on failure.
+ */
+int kmscon_font_shm_new(struct kmscon_font_shm **out, uint64_t key)
+{
+	struct kmscon_font_shm *shm;
+	struct shm_header *h;
+	const char *env;
+	char name[64];
+	struct stat st;
+	unsigned int i;
+	bool excl;
+	void *map;
+	int fd, ret;
+
+	if (!out)
+		return -EINVAL;
+
+	env = getenv("KMSCON_FONT_SHM");
+	if (env && !strcmp(env, "0"))
+		return -EOPNOTSUPP;
+
+	snprintf(name, sizeof(name), "/kmscon-glyphs-%016" PRIx64, key);
+	for (i = 0; ; ++i) {
+		fd = shm_open(name, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+		if (fd < 0) {
+			log_debug("cannot open shared glyph store %s (%d): %m",
+				  name, errno);
+			return -EFAULT;
+		}
+
+		/* Only a process without other users may initialize the
+		 * store. All others wait until it is ready. */
+		excl = !flock(fd, LOCK_EX | LOCK_NB);
+		if ((!excl && flock(fd, LOCK_SH)) || fstat(fd, &st)) {
+			ret = -EFAULT;
+			goto err_fd;
+		}
+
+		/* the last user unlinked it before we got the lock */
+		if (st.st_nlink)
+			break;
+
+		close(fd);
+		if (i >= SHM_RETRIES)
+			return -EBUSY;
+	}
+
+	if (st.st_uid != geteuid()) {
+		log_warning("shared glyph store %s owned by other user", name);
+		ret = -EACCES;
+		goto err_fd;
+	}
+
+	if (!st.st_size && !excl) {
+		log_debug("shared glyph store %s is not initialized", name);
+		ret = -EINVAL;
+		goto err_fd;
+	} else if (!st.st_size && ftruncate(fd, SHM_SIZE)) {
+		log_debug("cannot resize shared glyph store %s (%d): %m",
+			  name, errno);
+		ret = -EFAULT;
+		goto err_fd;
+	} else if (st.st_size && st.st_size != (off_t)SHM_SIZE) {
+		log_debug("shared glyph store %s has invalid size", name);
+		ret = -EINVAL;
+		goto err_fd;
+	}
+
+	map = mmap(NULL, SHM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		ret = -EFAULT;
+		goto err_fd;
+	}
+
+	h = map;
+	if (!st.st_size) {
+		h->key = key;
+		h->slots = SHM_SLOTS;
+		h->data_offset = sizeof(*h) + sizeof(struct shm_slot) *
+								SHM_SLOTS;
+		h->data_size = SHM_DATA_SIZE;
+		h->used = 0;
+		h->version = SHM_VERSION;
+		h->magic = SHM_MAGIC;
+	}
+
+	if (!header_valid(h, key)) {
+		log_debug("shared glyph store %s is incompatible", name);
+		ret = -EINVAL;
+		goto err_map;
+	}
+
+	shm = malloc(sizeof(*shm));
+	if (!shm) {
+		ret = -ENOMEM;
+		goto err_map;
+	}
+	memset(shm, 0, sizeof(*shm));
+
+	/* keep a shared lock as long as the store is used */
+	if (excl)
+		flock(fd, LOCK_SH);
+	shm->fd = fd;
+	strcpy(shm->name, name);
+	shm->map = map;
+	shm->size = SHM_SIZE;
+	shm->header = h;
+	shm->slots = (void*)(shm->map + sizeof(*h));
+
+	log_debug("using shared glyph store %s", name);
+	*out = shm;
+	return 0;
+
+err_map:
+	munmap(map, SHM_SIZE);
+err_fd:
+	close(fd);
+	return ret;
+}
+
+/**
+ * kmscon_font_shm_free:
+ * @shm: Store or NULL
+ *
+ * Unmaps the store. All glyphs returned by the store must be freed before.
+ * The shared object is unlinked if no other process uses it anymore.
+ */
+void kmscon_font_shm_free(struct kmscon_font_shm *shm)
+{
+	if (!shm)
+		return;
+
+	munmap(shm->map, shm->size);
+
+	/* other users hold shared locks, so this fails if any is left */
+	if (!flock(shm->fd, LOCK_EX | LOCK_NB)) {
+		log_debug("unlinking shared glyph store %s", shm->name);
+		shm_unlink(shm->name);
+	}
+
+	close(shm->fd);
+	free(shm);
+}
+
+static int new_glyph(struct kmscon_font_shm *shm, struct kmscon_glyph **out,
+		     const struct shm_slot *slot)
+{
+	struct kmscon_glyph *glyph;
+	uint32_t width, height, offset;
+
+	width = slot->width;
+	height = slot->height;
+	offset = slot->offset;
+
+	if (!width || !height || width > SHM_MAX_DIM || height > SHM_MAX_DIM)
+		return -EFAULT;
+	if (offset < shm->header->data_offset ||
+	    (size_t)offset + width * height > shm->size)
+		return -EFAULT;
+
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph)
+		return -ENOMEM;
+	memset(glyph, 0, sizeof(*glyph));
+	glyph->width = slot->cwidth;
+	glyph->buf.width = width;
+	glyph->buf.height = height;
+	glyph->buf.stride = width;
+	glyph->buf.format = UTERM_FORMAT_GREY;
+	glyph->buf.data = shm->map + offset;
+	glyph->data = shm;
+	kmscon_glyph_set_ink(glyph);
+
+	*out = glyph;
+	return 0;
+}
+
+/**
+ * kmscon_font_shm_find:
+ * @shm: Store or NULL
+ * @out: A new glyph referencing the shared bitmap is stored here
+ * @ch: Code-point to look up
+ *
+ * Returns: 0 on success, -ENOENT if the glyph is not (yet) available.
+ */
+int kmscon_font_shm_find(struct kmscon_font_shm *shm,
+			 struct kmscon_glyph **out, uint32_t ch)
+{
+	struct shm_slot *slot;
+	unsigned int i;
+	uint64_t state;
+
+	if (!shm)
+		return -ENOENT;
+
+	for (i = 0; i < SHM_PROBES; ++i) {
+		slot = get_slot(shm, ch, i);
+		state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+		if (state == slot_state(0, SLOT_EMPTY))
+			return -ENOENT;
+		if (state >> 32 != ch)
+			continue;
+		if (state != slot_state(ch, SLOT_READY))
+			return -ENOENT;
+
+		return new_glyph(shm, out, slot) ? -ENOENT : 0;
+	}
+
+	return -ENOENT;
+}
+
+/**
+ * kmscon_font_shm_add:
+ * @shm: Store or NULL
+ * @out: A new glyph referencing the shared bitmap is stored here
+ * @ch: Code-point of @glyph
+ * @glyph: A8 glyph to publish
+ *
+ * Publishes @glyph in the store and returns a glyph that references the shared
+ * copy. If another process already published the code-point, its copy is
+ * returned instead. The caller can free @glyph on success.
+ *
+ * Returns: 0 on success, negative error code if the glyph stays private.
+ */
+int kmscon_font_shm_add(struct kmscon_font_shm *shm,
+			struct kmscon_glyph **out, uint32_t ch,
+			const struct kmscon_glyph *glyph)
+{
+	const struct uterm_video_buffer *buf;
+	struct shm_slot *slot;
+	unsigned int i;
+	uint64_t state;
+	uint32_t size, offset;
+	uint8_t *dst;
+
+	if (!shm || !glyph)
+		return -EINVAL;
+
+	buf = &glyph->buf;
+	if (buf->format != UTERM_FORMAT_GREY || !buf->width ||
+	    !buf->height || buf->width > SHM_MAX_DIM ||
+	    buf->height > SHM_MAX_DIM)
+		return -EINVAL;
+
+	for (i = 0; i < SHM_PROBES; ++i) {
+		slot = get_slot(shm, ch, i);
+		state = slot_state(0, SLOT_EMPTY);
+		if (__atomic_compare_exchange_n(&slot->state, &state,
+						slot_state(ch, SLOT_WRITING),
+						false, __ATOMIC_ACQ_REL,
+						__ATOMIC_ACQUIRE))
+			break;
+
+		/* another process was faster */
+		if (state >> 32 == ch) {
+			if (state != slot_state(ch, SLOT_READY))
+				return -EBUSY;
+			return new_glyph(shm, out, slot);
+		}
+	}
+
+	if (i >= SHM_PROBES)
+		return -ENOSPC;
+
+	/* allocate bitmap space; never move the offset beyond the end */
+	size = buf->width * buf->height;
+	offset = __atomic_load_n(&shm->header->used, __ATOMIC_RELAXED);
+	do {
+		if (offset > SHM_DATA_SIZE || size > SHM_DATA_SIZE - offset) {
+			__atomic_store_n(&slot->state,
+					 slot_state(ch, SLOT_FAILED),
+					 __ATOMIC_RELEASE);
+			return -ENOSPC;
+		}
+	} while (!__atomic_compare_exchange_n(&shm->header->used, &offset,
+					      offset + size, true,
+					      __ATOMIC_RELAXED,
+					      __ATOMIC_RELAXED));
+	offset += shm->header->data_offset;
+
+	dst = shm->map + offset;
+	for (i = 0; i < buf->height; ++i)
+		memcpy(&dst[i * buf->width], &buf->data[i * buf->stride],
+		       buf->width);
+
+	slot->cwidth = glyph->width;
+	slot->width = buf->width;
+	slot->height = buf->height;
+	slot->offset = offset;
+	__atomic_store_n(&slot->state, slot_state(ch, SLOT_READY),
+			 __ATOMIC_RELEASE);
+
+	return new_glyph(shm, out, slot);
+}
@@ -0,0 +1,63 @@
+/*
+ * kmscon - Shared Glyph Store
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Shared Glyph Store
+ * When every VT runs its own kmscon process, each of them renders and keeps
+ * the same glyphs. The shared store is a POSIX shared-memory object per font
+ * face which all kmscon processes of the same user map. Glyph bitmaps are
+ * rendered once, published into the store and then used by all processes
+ * without copying them.
+ *
+ * Lookups are lock-free. Each slot is claimed atomically for one code-point
+ * by the first process that publishes it and becomes visible to readers only
+ * after the bitmap was written completely.
+ *
+ * Glyphs returned by this store have glyph->data set to the store. Their
+ * bitmaps must not be freed and the glyphs must be freed before the store.
+ * Stores are opened through the persistent glyph cache, whose key includes the
+ * backend, so each module and face uses an object of its own.
+ */
+
+#ifndef KMSCON_FONT_SHM_H
+#define KMSCON_FONT_SHM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "font.h"
+
+struct kmscon_font_shm;
+
+int kmscon_font_shm_new(struct kmscon_font_shm **out, uint64_t key);
+void kmscon_font_shm_free(struct kmscon_font_shm *shm);
+
+int kmscon_font_shm_find(struct kmscon_font_shm *shm,
+			 struct kmscon_glyph **out, uint32_t ch);
+int kmscon_font_shm_add(struct kmscon_font_shm *shm,
+			struct kmscon_glyph **out, uint32_t ch,
+			const struct kmscon_glyph *glyph);
+
+#endif /* KMSCON_FONT_SHM_H */
@@ -43,183 +43,218 @@
 #include <stdlib.h>
 #include <string.h>
 #include "font.h"
-#include "shl_hashtable.h"
 #include "shl_log.h"
 #include "uterm_video.h"
 
 #define LOG_SUBSYSTEM "font_unifont"
 
 /*
- * Glyph data is linked to the binary externally as binary data. The data layout
- * is a size-byte followed by 32 data bytes. The data bytes are padded with 0 if
- * the size is smaller than 32.
- * Sizes bigger than 32 are not used.
+ * Glyph data is linked to the binary externally as binary data. It is
+ * generated by src/genunifont.c which also documents the layout: a header, an
+ * index with one entry per block of 256 code-points, a record per non-empty
+ * block with presence and double-width bitmaps, and the 1-bpp glyph bitmaps.
+ * All integers are little-endian and the blob is not necessarily aligned, so
+ * they are read bytewise.
  */
 
-struct unifont_data {
-	uint8_t len;
-	uint8_t data[32];
-} __attribute__((__packed__));
+#define UNIFONT_MAX 0x30000
+#define UNIFONT_BLOCKS (UNIFONT_MAX >> 8)
+#define UNIFONT_EMPTY 0xffff
+#define UNIFONT_HEADER_SIZE 8
+#define UNIFONT_INDEX_SIZE (UNIFONT_BLOCKS * 2)
+#define UNIFONT_RECORD_SIZE (4 + 8 * 4 + 8 * 4)
 
-extern const struct unifont_data _binary_src_font_unifont_data_bin_start[];
-extern const struct unifont_data _binary_src_font_unifont_data_bin_end[];
+extern const uint8_t _binary_src_font_unifont_data_bin_start[];
+extern const uint8_t _binary_src_font_unifont_data_bin_end[];
 
 /*
- * Global glyph cache
- * The linked binary glyph data cannot be directly passed to the caller as it
- * has the wrong format. Hence, use a glyph-cache with all used glyphs and add
- * new ones as soon as they are used.
+ * Glyph blocks
+ * The bitmaps are used directly from the linked blob as UTERM_FORMAT_MONO
+ * buffers, so no glyph data is ever copied. Only the glyph descriptors are
+ * allocated, one array per block of 256 code-points on first use. Blocks are
+ * published with release-stores so lookups of loaded blocks do not lock.
+ * Descriptors are small and the bitmaps live in read-only memory shared by all
+ * kmscon processes, so the glyph cache budget does not apply here.
  */
 
 static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
-static struct shl_hashtable *cache;
+static struct kmscon_glyph *cache_blocks[UNIFONT_BLOCKS];
+static const uint8_t *cache_records;
+static const uint8_t *cache_data;
+static size_t cache_data_size;
 static unsigned long cache_refnum;
+static unsigned long cache_loaded;
+static unsigned long cache_entries;
+static unsigned long cache_hits;
+static unsigned long cache_misses;
 
-static void cache_ref(void)
+static uint32_t get_le16(const uint8_t *p)
 {
-	pthread_mutex_lock(&cache_mutex);
-	++cache_refnum;
-	pthread_mutex_unlock(&cache_mutex);
+	return p[0] | (p[1] << 8);
 }
 
-static void cache_unref(void)
+static uint32_t get_le32(const uint8_t *p)
 {
-	pthread_mutex_lock(&cache_mutex);
-	if (!--cache_refnum) {
-		shl_hashtable_free(cache);
-		cache = NULL;
-	}
-	pthread_mutex_unlock(&cache_mutex);
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
 }
 
-static void free_glyph(void *data)
+static int cache_ref(void)
 {
-	struct kmscon_glyph *g = data;
-
-	free(g->buf.data);
-	free(g);
-}
-
-static void unfold(uint8_t *dst, uint8_t val)
-{
-	*dst = 0xff * !!val;
-}
-
-static int find_glyph(uint32_t id, const struct kmscon_glyph **out)
-{
-	struct kmscon_glyph *g;
-	int ret;
-	bool res;
-	const struct unifont_data *start, *end, *d;
-	unsigned int i, w;
+	const uint8_t *start, *end;
+	size_t size, num;
+	int ret = 0;
 
 	pthread_mutex_lock(&cache_mutex);
 
-	if (!cache) {
-		ret = shl_hashtable_new(&cache, shl_direct_hash,
-					shl_direct_equal, NULL, free_glyph);
-		if (ret) {
-			log_error("cannot create unifont hashtable: %d", ret);
-			goto out_unlock;
-		}
-	} else {
-		res = shl_hashtable_find(cache, (void**)out,
-					 (void*)(long)id);
-		if (res) {
-			ret = 0;
-			goto out_unlock;
-		}
-	}
-
-	if (id > 0xffff) {
-		ret = -ERANGE;
+	if (cache_refnum) {
+		++cache_refnum;
 		goto out_unlock;
 	}
 
 	start = _binary_src_font_unifont_data_bin_start;
 	end = _binary_src_font_unifont_data_bin_end;
-	d = &start[id];
-
-	if (d >= end) {
-		ret = -ERANGE;
+	size = end - start;
+	if (size < UNIFONT_HEADER_SIZE + UNIFONT_INDEX_SIZE ||
+	    memcmp(start, "KUF1", 4)) {
+		log_error("invalid unifont glyph information in binary");
+		ret = -EFAULT;
 		goto out_unlock;
 	}
 
-	switch (d->len) {
-	case 16:
-		w = 1;
-		break;
-	case 32:
-		w = 2;
-		break;
-	default:
+	num = get_le32(&start[4]);
+	size -= UNIFONT_HEADER_SIZE + UNIFONT_INDEX_SIZE;
+	if (num > UNIFONT_BLOCKS || num * UNIFONT_RECORD_SIZE > size) {
+		log_error("truncated unifont glyph information in binary");
 		ret = -EFAULT;
 		goto out_unlock;
 	}
 
-	g = malloc(sizeof(*g));
-	if (!g) {
-		ret = -ENOMEM;
-		goto out_unlock;
-	}
-	memset(g, 0, sizeof(*g));
-	g->width = w;
-	g->buf.width = w * 8;
-	g->buf.height = 16;
-	g->buf.stride = w * 8;
-	g->buf.format = UTERM_FORMAT_GREY;
-
-	g->buf.data = malloc(g->buf.stride * g->buf.height);
-	if (!g->buf.data) {
-		ret = -ENOMEM;
-		goto err_free;
+	cache_records = &start[UNIFONT_HEADER_SIZE + UNIFONT_INDEX_SIZE];
+	cache_data = &cache_records[num * UNIFONT_RECORD_SIZE];
+	cache_data_size = size - num * UNIFONT_RECORD_SIZE;
+	cache_refnum = 1;
+
+out_unlock:
+	pthread_mutex_unlock(&cache_mutex);
+	return ret;
+}
+
+static void cache_unref(void)
+{
+	unsigned int i;
+
+	pthread_mutex_lock(&cache_mutex);
+	if (!--cache_refnum) {
+		log_debug("glyph cache: %lu blocks, %lu glyphs",
+			  cache_loaded, cache_entries);
+		for (i = 0; i < UNIFONT_BLOCKS; ++i) {
+			free(cache_blocks[i]);
+			cache_blocks[i] = NULL;
+		}
+		cache_loaded = 0;
+		cache_entries = 0;
 	}
+	pthread_mutex_unlock(&cache_mutex);
+}
+
+/* must be called with cache_mutex held */
+static struct kmscon_glyph *cache__load(unsigned int block)
+{
+	const uint8_t *rec, *index;
+	struct kmscon_glyph *glyphs, *g;
+	uint32_t off, present, wide;
+	unsigned int i, num, w;
+
+	glyphs = cache_blocks[block];
+	if (glyphs)
+		return glyphs;
+
+	index = &_binary_src_font_unifont_data_bin_start[UNIFONT_HEADER_SIZE];
+	num = get_le16(&index[block * 2]);
+	if (num == UNIFONT_EMPTY)
+		return NULL;
+
+	/* cache_ref() verified that all records are inside the blob */
+	rec = &cache_records[num * UNIFONT_RECORD_SIZE];
+	if (rec >= cache_data)
+		return NULL;
+
+	glyphs = calloc(256, sizeof(*glyphs));
+	if (!glyphs)
+		return NULL;
+
+	/* a zero width marks code-points without a glyph */
+	off = get_le32(rec);
+	for (i = 0; i < 256; ++i) {
+		present = get_le32(&rec[4 + i / 32 * 4]);
+		wide = get_le32(&rec[36 + i / 32 * 4]);
+		if (!(present & (1U << (i % 32))))
+			continue;
+
+		w = (wide & (1U << (i % 32))) ? 2 : 1;
+		if (off > cache_data_size || cache_data_size - off < w * 16) {
+			log_warning("unifont glyph %x out of bounds",
+				    block * 256 + i);
+			break;
+		}
 
-	for (i = 0; i < d->len; ++i) {
-		unfold(&g->buf.data[i * 8 + 0], d->data[i] & 0x80);
-		unfold(&g->buf.data[i * 8 + 1], d->data[i] & 0x40);
-		unfold(&g->buf.data[i * 8 + 2], d->data[i] & 0x20);
-		unfold(&g->buf.data[i * 8 + 3], d->data[i] & 0x10);
-		unfold(&g->buf.data[i * 8 + 4], d->data[i] & 0x08);
-		unfold(&g->buf.data[i * 8 + 5], d->data[i] & 0x04);
-		unfold(&g->buf.data[i * 8 + 6], d->data[i] & 0x02);
-		unfold(&g->buf.data[i * 8 + 7], d->data[i] & 0x01);
+		g = &glyphs[i];
+		g->width = w;
+		g->buf.width = w * 8;
+		g->buf.height = 16;
+		g->buf.stride = w;
+		g->buf.format = UTERM_FORMAT_MONO;
+		g->buf.data = (uint8_t*)&cache_data[off];
+		kmscon_glyph_set_ink(g);
+		off += w * 16;
+		++cache_entries;
 	}
 
-	ret = shl_hashtable_insert(cache, (void*)(long)id, g);
-	if (ret) {
-		log_error("cannot insert glyph into glyph-cache: %d", ret);
-		goto err_data;
+	++cache_loaded;
+	__atomic_store_n(&cache_blocks[block], glyphs, __ATOMIC_RELEASE);
+	return glyphs;
+}
+
+static int find_glyph(uint32_t id, const struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyphs;
+	unsigned int block;
+
+	if (id >= UNIFONT_MAX)
+		return -ERANGE;
+
+	block = id >> 8;
+	glyphs = __atomic_load_n(&cache_blocks[block], __ATOMIC_ACQUIRE);
+	if (glyphs) {
+		/* statistics are best-effort only */
+		++cache_hits;
+	} else {
+		pthread_mutex_lock(&cache_mutex);
+		glyphs = cache__load(block);
+		++cache_misses;
+		pthread_mutex_unlock(&cache_mutex);
+		if (!glyphs)
+			return -ERANGE;
 	}
 
-	*out = g;
-	ret = 0;
-	goto out_unlock;
+	if (!glyphs[id & 0xff].width)
+		return -ERANGE;
 
-err_data:
-	free(g->buf.data);
-err_free:
-	free(g);
-out_unlock:
-	pthread_mutex_unlock(&cache_mutex);
-	return ret;
+	*out = &glyphs[id & 0xff];
+	return 0;
 }
 
 static int kmscon_font_unifont_init(struct kmscon_font *out,
 				    const struct kmscon_font_attr *attr)
 {
 	static const char name[] = "static-unifont";
-	const struct unifont_data *start, *end;
+	int ret;
 
 	log_debug("loading static unifont font");
 
-	start = _binary_src_font_unifont_data_bin_start;
-	end = _binary_src_font_unifont_data_bin_end;
-	if (start == end) {
-		log_error("unifont glyph information not found in binary");
-		return -EFAULT;
-	}
-
+	ret = cache_ref();
+	if (ret)
+		return ret;
 
 	memset(&out->attr, 0, sizeof(out->attr));
 	memcpy(out->attr.name, name, sizeof(name));
@@ -230,7 +265,6 @@ static int kmscon_font_unifont_init(struct kmscon_font *out,
 	kmscon_font_attr_normalize(&out->attr);
 	out->baseline = 4;
 
-	cache_ref();
 	return 0;
 }
 
@@ -262,6 +296,19 @@ static int kmscon_font_unifont_render_empty(struct kmscon_font *font,
 	return find_glyph(' ', out);
 }
 
+static void kmscon_font_unifont_get_stats(struct kmscon_font *font,
+					  struct kmscon_glyph_stats *stats)
+{
+	pthread_mutex_lock(&cache_mutex);
+	stats->size = cache_loaded * 256 * sizeof(struct kmscon_glyph);
+	stats->limit = 0;
+	stats->entries = cache_entries;
+	stats->hits = cache_hits;
+	stats->misses = cache_misses;
+	stats->evictions = 0;
+	pthread_mutex_unlock(&cache_mutex);
+}
+
 struct kmscon_font_ops kmscon_font_unifont_ops = {
 	.name = "unifont",
 	.owner = NULL,
@@ -270,4 +317,5 @@ struct kmscon_font_ops kmscon_font_unifont_ops = {
 	.render = kmscon_font_unifont_render,
 	.render_empty = kmscon_font_unifont_render_empty,
 	.render_inval = kmscon_font_unifont_render_inval,
+	.get_stats = kmscon_font_unifont_get_stats,
 };
@@ -0,0 +1,58 @@
+/*
+ * kmscon - Character Width Lookup
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Character Width Lookup
+ * Cell widths of all code-points are precomputed at build time by genwidth
+ * from external/wcwidth.c, the same wcwidth() implementation libtsm uses for
+ * its cell layout. The table is split into blocks of 256 code-points and equal
+ * blocks are shared, so stage1 maps a block to its stage2 row and a lookup is
+ * just two array loads instead of a binary search over interval tables.
+ *
+ * Unlike wcwidth(), non-printable characters have width 0 like with
+ * tsm_ucs4_get_width(). test_width verifies both agree on all code-points.
+ */
+
+#ifndef KMSCON_FONT_WIDTH_H
+#define KMSCON_FONT_WIDTH_H
+
+#include <stdint.h>
+
+#define KMSCON_WIDTH_MAX 0x110000
+#define KMSCON_WIDTH_BLOCKS (KMSCON_WIDTH_MAX >> 8)
+
+extern const uint8_t kmscon_width_stage1[KMSCON_WIDTH_BLOCKS];
+extern const uint8_t kmscon_width_stage2[][256];
+
+static inline unsigned int kmscon_ucs4_get_width(uint32_t ucs4)
+{
+	/* wcwidth() treats everything beyond unicode as narrow */
+	if (ucs4 >= KMSCON_WIDTH_MAX)
+		return 1;
+
+	return kmscon_width_stage2[kmscon_width_stage1[ucs4 >> 8]][ucs4 & 0xff];
+}
+
+#endif /* KMSCON_FONT_WIDTH_H */
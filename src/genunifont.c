@@ -26,8 +26,24 @@
 
 /*
  * Unifont Generator
- * This converts the hex-encoded Unifont data into a C-array that is used by the
- * unifont-font-renderer.
+ * This converts the hex-encoded Unifont data into a binary blob that is linked
+ * into the unifont-font-renderer. Several input files can be given, so the
+ * upper planes (unifont_upper.hex) can be merged with the BMP glyphs.
+ *
+ * The blob is sparse and indexed so the renderer can use the glyph bitmaps
+ * directly without unpacking them. All integers are little-endian:
+ *   header: "KUF1" followed by a le32 number of block records
+ *   index:  one le16 per block of 256 code-points up to UNIFONT_MAX; the
+ *           block record number or 0xffff if the block is empty
+ *   blocks: for each record a le32 data offset followed by 8 le32 words with
+ *           one bit per present code-point and 8 le32 words with one bit
+ *           per double-width code-point (bit n of word w is code-point
+ *           w * 32 + n of the block)
+ *   data:   1-bpp bitmaps, 16 rows of 1 byte (narrow) or 2 bytes (wide),
+ *           most significant bit first, stored in code-point order
+ * The bitmap of a code-point is at the data offset of its block plus 16 bytes
+ * for each present and 16 more for each wide code-point before it.
+ * Keep this in sync with src/font_unifont.c.
  */
 
 #include <errno.h>
@@ -38,6 +54,10 @@
 
 #define MAX_DATA_SIZE 255
 
+#define UNIFONT_MAX 0x30000
+#define UNIFONT_BLOCKS (UNIFONT_MAX >> 8)
+#define UNIFONT_EMPTY 0xffff
+
 struct unifont_glyph {
 	struct unifont_glyph *next;
 	uint32_t codepoint;
@@ -45,6 +65,12 @@ struct unifont_glyph {
 	char data[MAX_DATA_SIZE];
 };
 
+struct unifont_block {
+	uint32_t offset;
+	uint32_t present[8];
+	uint32_t wide[8];
+};
+
 static uint8_t hex_val(char c)
 {
 	if (c >= '0' && c <= '9')
@@ -58,29 +84,30 @@ static uint8_t hex_val(char c)
 	return 0;
 }
 
+static void print_le16(FILE *out, uint16_t val)
+{
+	fputc(val & 0xff, out);
+	fputc(val >> 8, out);
+}
+
+static void print_le32(FILE *out, uint32_t val)
+{
+	fputc(val & 0xff, out);
+	fputc((val >> 8) & 0xff, out);
+	fputc((val >> 16) & 0xff, out);
+	fputc(val >> 24, out);
+}
+
 static void print_unifont_glyph(FILE *out, const struct unifont_glyph *g)
 {
 	size_t i;
 	uint8_t val;
 
-	switch (g->len) {
-	case 32:
-	case 64:
-		break;
-	default:
-		fprintf(stderr, "genunifont: invalid data size %d for %x",
-			g->len, g->codepoint);
-		return;
-	}
-
-	fprintf(out, "%c", g->len / 2);
 	for (i = 0; i < g->len; i += 2) {
 		val = hex_val(g->data[i]) << 4;
 		val |= hex_val(g->data[i + 1]);
-		fprintf(out, "%c", val);
+		fputc(val, out);
 	}
-	for ( ; i < 64; i += 2)
-		fprintf(out, "%c", 0);
 }
 
 static int build_unifont_glyph(struct unifont_glyph *g, const char *buf)
@@ -101,7 +128,8 @@ static int build_unifont_glyph(struct unifont_glyph *g, const char *buf)
 
 	g->codepoint = val;
 	g->len = 0;
-	while (*buf && *buf != '\n' && g->len < MAX_DATA_SIZE) {
+	while (*buf && *buf != '\n' && *buf != '\r' &&
+	       g->len < MAX_DATA_SIZE) {
 		g->data[g->len] = *buf++;
 		++g->len;
 	}
@@ -109,16 +137,12 @@ static int build_unifont_glyph(struct unifont_glyph *g, const char *buf)
 	return 0;
 }
 
-static int parse_single_file(FILE *out, FILE *in)
+static int parse_single_file(struct unifont_glyph **list,
+			     struct unifont_glyph **last, FILE *in)
 {
-	static const struct unifont_glyph replacement = {
-		.codepoint = 0,
-		.len = 32,
-		.data = "0000007E665A5A7A76767E76767E0000"
-	};
 	char buf[MAX_DATA_SIZE];
-	struct unifont_glyph *g, **iter, *list, *last;
-	int ret, num;
+	struct unifont_glyph *g, **iter;
+	int ret;
 	long status_max, status_cur;
 	unsigned long perc_prev, perc_now;
 
@@ -139,8 +163,6 @@ static int parse_single_file(FILE *out, FILE *in)
 	}
 
 	rewind(in);
-	list = NULL;
-	last = NULL;
 	status_cur = 0;
 	perc_prev = 0;
 	perc_now = 0;
@@ -176,11 +198,20 @@ static int parse_single_file(FILE *out, FILE *in)
 			return ret;
 		}
 
+		/* skip glyphs that the blob cannot index */
+		if (g->codepoint >= UNIFONT_MAX ||
+		    (g->len != 32 && g->len != 64)) {
+			fprintf(stderr, "\ngenunifont: skipping glyph %x of size %d\n",
+				g->codepoint, g->len);
+			free(g);
+			continue;
+		}
+
 		/* find glyph position */
-		if (last && last->codepoint < g->codepoint) {
-			iter = &last->next;
+		if (*last && (*last)->codepoint < g->codepoint) {
+			iter = &(*last)->next;
 		} else {
-			iter = &list;
+			iter = list;
 			while (*iter && (*iter)->codepoint < g->codepoint)
 				iter = &(*iter)->next;
 
@@ -195,33 +226,76 @@ static int parse_single_file(FILE *out, FILE *in)
 		/* insert glyph into single-linked list */
 		g->next = *iter;
 		if (!*iter)
-			last = g;
+			*last = g;
 		*iter = g;
 	}
 
 	fprintf(stderr, "\b\b\b\b%3d%%\n", 100);
 
-	/* print all glyph-data to output file */
+	return 0;
+}
+
+static void print_unifont(FILE *out, struct unifont_glyph *list)
+{
+	static uint16_t index[UNIFONT_BLOCKS];
+	static struct unifont_block blocks[UNIFONT_BLOCKS];
+	struct unifont_glyph *g;
+	struct unifont_block *b;
+	unsigned int i, j, num, cp;
+	uint32_t size;
+
+	/* assign block records and data offsets in code-point order */
+	for (i = 0; i < UNIFONT_BLOCKS; ++i)
+		index[i] = UNIFONT_EMPTY;
+
 	num = 0;
+	size = 0;
+	for (g = list; g; g = g->next) {
+		i = g->codepoint >> 8;
+		if (index[i] == UNIFONT_EMPTY) {
+			index[i] = num;
+			blocks[num].offset = size;
+			++num;
+		}
+
+		b = &blocks[index[i]];
+		cp = g->codepoint & 0xff;
+		b->present[cp / 32] |= 1U << (cp % 32);
+		if (g->len == 64)
+			b->wide[cp / 32] |= 1U << (cp % 32);
+		size += g->len / 2;
+	}
+
+	fprintf(out, "KUF1");
+	print_le32(out, num);
+
+	for (i = 0; i < UNIFONT_BLOCKS; ++i)
+		print_le16(out, index[i]);
+
+	for (i = 0; i < num; ++i) {
+		print_le32(out, blocks[i].offset);
+		for (j = 0; j < 8; ++j)
+			print_le32(out, blocks[i].present[j]);
+		for (j = 0; j < 8; ++j)
+			print_le32(out, blocks[i].wide[j]);
+	}
+
 	while (list) {
 		g = list;
 		list = g->next;
-
-		/* print replacements if glyphs are missing */
-		while (num++ < g->codepoint)
-			print_unifont_glyph(out, &replacement);
-
 		print_unifont_glyph(out, g);
 		free(g);
 	}
 
-	return 0;
+	fprintf(stderr, "genunifont: %u blocks, %u bytes of glyph data\n",
+		num, size);
 }
 
 int main(int argc, char **argv)
 {
 	FILE *out, *in;
-	int ret;
+	struct unifont_glyph *list = NULL, *last = NULL;
+	int ret, i;
 
 	if (argc < 3) {
 		fprintf(stderr, "genunifont: use ./genunifont <outputfile> <inputfiles>\n");
@@ -237,23 +311,28 @@ int main(int argc, char **argv)
 		goto err_out;
 	}
 
-	in = fopen(argv[2], "rb");
-	if (!in) {
-		fprintf(stderr, "genunifont: cannot open %s: %m\n",
-			argv[2]);
-		ret = EXIT_FAILURE;
-	} else {
-		ret = parse_single_file(out, in);
+	ret = EXIT_SUCCESS;
+	for (i = 2; i < argc; ++i) {
+		in = fopen(argv[i], "rb");
+		if (!in) {
+			fprintf(stderr, "genunifont: cannot open %s: %m\n",
+				argv[i]);
+			ret = EXIT_FAILURE;
+			break;
+		}
+
+		ret = parse_single_file(&list, &last, in);
+		fclose(in);
 		if (ret) {
 			fprintf(stderr, "genunifont: parsing input %s failed",
-				argv[2]);
+				argv[i]);
 			ret = EXIT_FAILURE;
-		} else {
-			ret = EXIT_SUCCESS;
+			break;
 		}
-		fclose(in);
 	}
 
+	if (ret == EXIT_SUCCESS)
+		print_unifont(out, list);
 
 	fclose(out);
 err_out:
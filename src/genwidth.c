@@ -0,0 +1,163 @@
+/*
+ * kmscon - Generate Character Width Tables
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Character Width Table Generator
+ * This evaluates mk_wcwidth() of external/wcwidth.c for every code-point and
+ * writes the two-level lookup table used by src/font_width.h as C source.
+ * Code-points are grouped into blocks of 256. Each distinct block is emitted
+ * once into stage2 and stage1 maps every block to its stage2 row. As most
+ * blocks are all narrow or all wide, only a few dozen rows are needed.
+ *
+ * The table must agree with tsm_ucs4_get_width() of the libtsm kmscon is
+ * linked against, otherwise glyphs are rendered with a different width than
+ * the cells tsm reserved for them. To move to a new Unicode version, update
+ * the interval tables in external/wcwidth.c to the ones libtsm uses and
+ * rebuild; test_width compares both on all code-points.
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include "../external/wcwidth.h"
+
+#define WIDTH_MAX 0x110000
+#define WIDTH_BLOCKS (WIDTH_MAX >> 8)
+#define WIDTH_ROWS 256
+
+static uint8_t stage1[WIDTH_BLOCKS];
+static uint8_t stage2[WIDTH_ROWS][256];
+static unsigned int num_rows;
+
+static unsigned int get_width(uint32_t ucs4)
+{
+	int ret;
+
+	/* non-printable characters are 0, like tsm_ucs4_get_width() */
+	ret = mk_wcwidth(ucs4);
+	if (ret <= 0)
+		return 0;
+	return ret;
+}
+
+static int build_tables(void)
+{
+	uint8_t row[256];
+	unsigned int block, i;
+
+	for (block = 0; block < WIDTH_BLOCKS; ++block) {
+		for (i = 0; i < 256; ++i)
+			row[i] = get_width(block * 256 + i);
+
+		for (i = 0; i < num_rows; ++i) {
+			if (!memcmp(stage2[i], row, sizeof(row)))
+				break;
+		}
+
+		if (i == num_rows) {
+			if (num_rows >= WIDTH_ROWS) {
+				fprintf(stderr, "genwidth: too many distinct blocks\n");
+				return -EFBIG;
+			}
+			memcpy(stage2[num_rows++], row, sizeof(row));
+		}
+
+		stage1[block] = i;
+	}
+
+	return 0;
+}
+
+static void print_tables(FILE *out)
+{
+	unsigned int i, j;
+
+	fprintf(out, "/* generated by genwidth from external/wcwidth.c, do not edit */\n\n");
+	fprintf(out, "#include <stdint.h>\n");
+	fprintf(out, "#include \"font_width.h\"\n");
+	fprintf(out, "#include \"shl_misc.h\"\n\n");
+
+	fprintf(out, "SHL_EXPORT\nconst uint8_t kmscon_width_stage1[KMSCON_WIDTH_BLOCKS] = {");
+	for (i = 0; i < WIDTH_BLOCKS; ++i) {
+		if (!(i % 16))
+			fprintf(out, "\n\t");
+		fprintf(out, "%u,", stage1[i]);
+	}
+	fprintf(out, "\n};\n\n");
+
+	fprintf(out, "SHL_EXPORT\nconst uint8_t kmscon_width_stage2[%u][256] = {\n",
+		num_rows);
+	for (i = 0; i < num_rows; ++i) {
+		fprintf(out, "\t{");
+		for (j = 0; j < 256; ++j) {
+			if (!(j % 32))
+				fprintf(out, "\n\t\t");
+			fprintf(out, "%u,", stage2[i][j]);
+		}
+		fprintf(out, "\n\t},\n");
+	}
+	fprintf(out, "};\n");
+}
+
+int main(int argc, char **argv)
+{
+	FILE *out;
+	int ret;
+
+	if (argc != 2) {
+		fprintf(stderr, "genwidth: use ./genwidth <outputfile>\n");
+		ret = EXIT_FAILURE;
+		goto err_out;
+	}
+
+	ret = build_tables();
+	if (ret) {
+		ret = EXIT_FAILURE;
+		goto err_out;
+	}
+
+	out = fopen(argv[1], "wb");
+	if (!out) {
+		fprintf(stderr, "genwidth: cannot open output %s: %m\n",
+			argv[1]);
+		ret = EXIT_FAILURE;
+		goto err_out;
+	}
+
+	print_tables(out);
+	ret = EXIT_SUCCESS;
+
+	if (fclose(out)) {
+		fprintf(stderr, "genwidth: cannot write output %s: %m\n",
+			argv[1]);
+		ret = EXIT_FAILURE;
+	}
+
+err_out:
+	return ret;
+}
@@ -151,7 +151,13 @@ static void print_help()
 		"\t    --font-name <name>      [monospace]\n"
 		"\t                              Font name\n"
 		"\t    --font-dpi <dpi>        [96]\n"
-		"\t                              Force DPI value for all fonts\n",
+		"\t                              Force DPI value for all fonts\n"
+		"\t    --font-synthetic-bold   [off]\n"
+		"\t                              Derive bold glyphs from the regular\n"
+		"\t                              font instead of loading a bold font\n"
+		"\t    --glyph-cache-size <KiB> [8192]\n"
+		"\t                              Memory budget of each glyph cache,\n"
+		"\t                              0 for unlimited caches\n",
 		"kmscon");
 	/*
 	 * 80 char line:
@@ -603,6 +609,8 @@ int kmscon_conf_new(struct conf_ctx **out)
 		CONF_OPTION_UINT(0, "font-size", &conf->font_size, 12),
 		CONF_OPTION_STRING(0, "font-name", &conf->font_name, "monospace"),
 		CONF_OPTION_UINT(0, "font-dpi", &conf->font_ppi, 96),
+		CONF_OPTION_BOOL(0, "font-synthetic-bold", &conf->font_synthetic_bold, false),
+		CONF_OPTION_UINT(0, "glyph-cache-size", &conf->glyph_cache_size, 8192),
 	};
 
 	ret = conf_ctx_new(&ctx, options, sizeof(options) / sizeof(*options),
@@ -152,6 +152,10 @@ struct kmscon_conf_t {
 	char *font_name;
 	/* font ppi (overrides per monitor PPI) */
 	unsigned int font_ppi;
+	/* derive bold glyphs from the regular font */
+	bool font_synthetic_bold;
+	/* glyph cache budget in KiB */
+	unsigned int glyph_cache_size;
 };
 
 int kmscon_conf_new(struct conf_ctx **out);
@@ -616,6 +616,7 @@ int main(int argc, char **argv)
 	kmscon_load_modules();
 	kmscon_font_register(&kmscon_font_8x16_ops);
 	kmscon_text_register(&kmscon_text_bblit_ops);
+	kmscon_font_set_cache_limit((size_t)conf->glyph_cache_size * 1024);
 
 	memset(&app, 0, sizeof(app));
 	app.conf_ctx = conf_ctx;
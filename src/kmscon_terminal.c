@@ -35,6 +35,7 @@
 #include <libtsm.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "conf.h"
 #include "eloop.h"
 #include "kmscon_conf.h"
@@ -49,6 +50,15 @@
 
 #define LOG_SUBSYSTEM "terminal"
 
+/* number of font sizes kept loaded so zooming back and forth is instant */
+#define TERMINAL_FONTS 4
+
+struct term_font {
+	unsigned int points;
+	struct kmscon_font *font;
+	struct kmscon_font *bold_font;
+};
+
 struct screen {
 	struct shl_dlist list;
 	struct kmscon_terminal *term;
@@ -82,6 +92,11 @@ struct kmscon_terminal {
 	struct kmscon_font_attr font_attr;
 	struct kmscon_font *font;
 	struct kmscon_font *bold_font;
+
+	/* loaded font sizes, most recently used first; the fonts above are
+	 * interim fonts wrapping the first entry while zooming */
+	struct term_font fonts[TERMINAL_FONTS];
+	struct ev_timer *zoom_timer;
 };
 
 static void do_clear_margins(struct screen *scr)
@@ -114,6 +129,7 @@ static void do_clear_margins(struct screen *scr)
 static void do_redraw_screen(struct screen *scr)
 {
 	int ret;
+	tsm_age_t age;
 
 	if (!scr->term->awake)
 		return;
@@ -122,7 +138,9 @@ static void do_redraw_screen(struct screen *scr)
 	do_clear_margins(scr);
 
 	kmscon_text_prepare(scr->txt);
-	tsm_screen_draw(scr->term->console, kmscon_text_draw_cb, scr->txt);
+	age = tsm_screen_draw(scr->term->console, kmscon_text_draw_cb,
+			      scr->txt);
+	kmscon_text_set_age(scr->txt, age);
 	kmscon_text_render(scr->txt);
 
 	ret = uterm_display_swap(scr->disp, false);
@@ -226,25 +244,168 @@ static void terminal_resize(struct kmscon_terminal *term,
 	redraw_all(term);
 }
 
-static int font_set(struct kmscon_terminal *term)
+static int font_load(struct kmscon_terminal *term, struct term_font *tf)
 {
 	int ret;
-	struct kmscon_font *font, *bold_font;
-	struct shl_dlist *iter;
-	struct screen *ent;
 
 	term->font_attr.bold = false;
-	ret = kmscon_font_find(&font, &term->font_attr,
+	ret = kmscon_font_find(&tf->font, &term->font_attr,
 			       term->conf->font_engine);
 	if (ret)
 		return ret;
 
-	term->font_attr.bold = true;
-	ret = kmscon_font_find(&bold_font, &term->font_attr,
-			       term->conf->font_engine);
+	if (term->conf->font_synthetic_bold) {
+		ret = kmscon_font_new_bold(&tf->bold_font, tf->font);
+	} else {
+		term->font_attr.bold = true;
+		ret = kmscon_font_find(&tf->bold_font, &term->font_attr,
+				       term->conf->font_engine);
+	}
 	if (ret) {
 		log_warning("cannot create bold font: %d", ret);
-		bold_font = font;
+		tf->bold_font = tf->font;
+		kmscon_font_ref(tf->bold_font);
+	}
+
+	tf->points = term->font_attr.points;
+	return 0;
+}
+
+static void font_unload(struct term_font *tf)
+{
+	kmscon_font_unref(tf->bold_font);
+	kmscon_font_unref(tf->font);
+	memset(tf, 0, sizeof(*tf));
+}
+
+static void free_fonts(struct kmscon_terminal *term)
+{
+	unsigned int i;
+
+	kmscon_font_unref(term->bold_font);
+	kmscon_font_unref(term->font);
+	term->bold_font = NULL;
+	term->font = NULL;
+
+	for (i = 0; i < TERMINAL_FONTS; ++i) {
+		if (term->fonts[i].font)
+			font_unload(&term->fonts[i]);
+	}
+}
+
+/* Wrap @tf in interim fonts that scale the glyphs of @prev until the glyphs of
+ * the new size are rasterized. Falls back to the plain fonts on errors. */
+static void font_interim(struct term_font *tf, const struct term_font *prev,
+			 struct kmscon_font **font,
+			 struct kmscon_font **bold_font)
+{
+	int ret;
+
+	ret = kmscon_font_new_interim(font, tf->font, prev->font);
+	if (ret) {
+		log_warning("cannot create interim font: %d", ret);
+		goto err_plain;
+	}
+
+	if (tf->bold_font == tf->font) {
+		*bold_font = *font;
+		kmscon_font_ref(*bold_font);
+		return;
+	}
+
+	ret = kmscon_font_new_interim(bold_font, tf->bold_font,
+				      prev->bold_font);
+	if (!ret)
+		return;
+
+	log_warning("cannot create interim bold font: %d", ret);
+	kmscon_font_unref(*font);
+err_plain:
+	*font = tf->font;
+	*bold_font = tf->bold_font;
+	kmscon_font_ref(*font);
+	kmscon_font_ref(*bold_font);
+}
+
+static void zoom_event(struct ev_timer *timer, uint64_t num, void *data)
+{
+	struct kmscon_terminal *term = data;
+	struct shl_dlist *iter;
+	struct screen *scr;
+	unsigned int ready = 0, bold_ready = 0;
+	int pending, bold_pending = 0;
+
+	pending = kmscon_font_interim_update(term->font, &ready);
+	if (term->bold_font != term->font)
+		bold_pending = kmscon_font_interim_update(term->bold_font,
+							  &bold_ready);
+
+	if (ready || bold_ready) {
+		shl_dlist_for_each(iter, &term->screens) {
+			scr = shl_dlist_entry(iter, struct screen, list);
+			kmscon_text_flush(scr->txt);
+		}
+		redraw_all(term);
+	}
+
+	if (pending <= 0 && bold_pending <= 0) {
+		kmscon_font_interim_finish(term->font);
+		kmscon_font_interim_finish(term->bold_font);
+		ev_timer_update(timer, NULL);
+	}
+}
+
+/*
+ * Change font size
+ * Rasterizing a whole screen in a new size stalls the terminal, so on zoom the
+ * new fonts are wrapped in interim fonts which serve scaled copies of the
+ * glyphs of the previous size while the real glyphs are rasterized. The zoom
+ * timer swaps them in as they become ready. Recently used sizes stay loaded
+ * together with their glyph caches so toggling between them is instant.
+ */
+static int font_set(struct kmscon_terminal *term)
+{
+	int ret;
+	struct kmscon_font *font, *bold_font;
+	struct term_font tf;
+	struct shl_dlist *iter;
+	struct screen *ent;
+	struct itimerspec spec;
+	unsigned int i;
+	bool zoom;
+
+	zoom = term->fonts[0].font &&
+	       term->fonts[0].points != term->font_attr.points;
+
+	for (i = 0; i < TERMINAL_FONTS; ++i) {
+		if (!term->fonts[i].font ||
+		    term->fonts[i].points == term->font_attr.points)
+			break;
+	}
+
+	if (i < TERMINAL_FONTS && term->fonts[i].font) {
+		tf = term->fonts[i];
+	} else {
+		ret = font_load(term, &tf);
+		if (ret)
+			return ret;
+
+		if (i == TERMINAL_FONTS) {
+			--i;
+			font_unload(&term->fonts[i]);
+		}
+	}
+
+	memmove(&term->fonts[1], &term->fonts[0], sizeof(tf) * i);
+	term->fonts[0] = tf;
+
+	if (zoom) {
+		font_interim(&term->fonts[0], &term->fonts[1], &font,
+			     &bold_font);
+	} else {
+		font = tf.font;
+		bold_font = tf.bold_font;
+		kmscon_font_ref(font);
 		kmscon_font_ref(bold_font);
 	}
 
@@ -270,6 +431,14 @@ static int font_set(struct kmscon_terminal *term)
 	}
 
 	terminal_resize(term, 0, 0, true, true);
+
+	if (font != tf.font) {
+		spec.it_value.tv_sec = 0;
+		spec.it_value.tv_nsec = 20L * 1000L * 1000L; /* 20ms */
+		spec.it_interval = spec.it_value;
+		ev_timer_update(term->zoom_timer, &spec);
+	}
+
 	return 0;
 }
 
@@ -514,8 +683,8 @@ static void terminal_destroy(struct kmscon_terminal *term)
 	uterm_input_unregister_cb(term->input, input_event, term);
 	ev_eloop_rm_fd(term->ptyfd);
 	kmscon_pty_unref(term->pty);
-	kmscon_font_unref(term->bold_font);
-	kmscon_font_unref(term->font);
+	ev_eloop_rm_timer(term->zoom_timer);
+	free_fonts(term);
 	tsm_vte_unref(term->vte);
 	tsm_screen_unref(term->console);
 	uterm_input_unref(term->input);
@@ -622,10 +791,15 @@ int kmscon_terminal_register(struct kmscon_session **out,
 		goto err_con;
 	tsm_vte_set_palette(term->vte, term->conf->palette);
 
-	ret = font_set(term);
+	ret = ev_eloop_new_timer(term->eloop, &term->zoom_timer, NULL,
+				 zoom_event, term);
 	if (ret)
 		goto err_vte;
 
+	ret = font_set(term);
+	if (ret)
+		goto err_timer;
+
 	ret = kmscon_pty_new(&term->pty, pty_input, term);
 	if (ret)
 		goto err_font;
@@ -684,8 +858,9 @@ err_ptyfd:
 err_pty:
 	kmscon_pty_unref(term->pty);
 err_font:
-	kmscon_font_unref(term->bold_font);
-	kmscon_font_unref(term->font);
+	free_fonts(term);
+err_timer:
+	ev_eloop_rm_timer(term->zoom_timer);
 err_vte:
 	tsm_vte_unref(term->vte);
 err_con:
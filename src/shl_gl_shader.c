@@ -27,18 +27,28 @@
  * Shader API
  * This provides basic shader objects that are used to draw sprites and
  * textures.
+ * If GL_OES_get_program_binary is available and $KMSCON_GL_CACHE_DIR is set,
+ * linked programs are stored in this directory and loaded from there on the
+ * next start instead of compiling the shaders again.
  */
 
 #define GL_GLEXT_PROTOTYPES
 
 #include <errno.h>
+#include <fcntl.h>
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
+#include <inttypes.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
 #include "shl_gl.h"
 #include "shl_llog.h"
+#include "shl_misc.h"
 
 #define LLOG_SUBSYSTEM "gl_shader"
 
@@ -133,6 +143,222 @@ static int compile_shader(struct gl_shader *shader, GLenum type,
 	return s;
 }
 
+#ifdef GL_OES_get_program_binary
+
+#define CACHE_MAGIC 0x42474c4b
+#define CACHE_VERSION 1
+
+struct cache_header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t format;
+	uint32_t length;
+};
+
+static uint64_t hash_data(uint64_t hash, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	size_t i;
+
+	/* FNV-1a */
+	for (i = 0; i < len; ++i) {
+		hash ^= p[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+static uint64_t hash_str(uint64_t hash, const char *str)
+{
+	if (!str)
+		str = "";
+
+	/* include the terminating 0 so concatenations differ */
+	return hash_data(hash, str, strlen(str) + 1);
+}
+
+/* Returns the path of the cache file for this program or NULL if caching is
+ * disabled. The key covers the sources, the attribute bindings and the GL
+ * implementation so a driver update invalidates all entries. */
+static char *cache_path(const char *vert, int vert_len,
+			const char *frag, int frag_len,
+			char **attr, size_t attr_count, uint64_t *key)
+{
+	const char *dir, *ext;
+	char *path;
+	uint64_t hash = 14695981039346656037ULL;
+	GLint num = 0;
+	size_t i;
+	int ret;
+
+	dir = getenv("KMSCON_GL_CACHE_DIR");
+	if (!dir || !*dir)
+		return NULL;
+
+	ext = (const char*)glGetString(GL_EXTENSIONS);
+	if (!ext || !strstr(ext, "GL_OES_get_program_binary"))
+		return NULL;
+
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS_OES, &num);
+	if (num <= 0)
+		return NULL;
+
+	hash = hash_data(hash, vert, vert_len);
+	hash = hash_data(hash, frag, frag_len);
+	for (i = 0; i < attr_count; ++i)
+		hash = hash_str(hash, attr[i]);
+	hash = hash_str(hash, (const char*)glGetString(GL_VENDOR));
+	hash = hash_str(hash, (const char*)glGetString(GL_RENDERER));
+	hash = hash_str(hash, (const char*)glGetString(GL_VERSION));
+
+	ret = asprintf(&path, "%s/gl-%016" PRIx64 ".bin", dir, hash);
+	if (ret < 0)
+		return NULL;
+
+	*key = hash;
+	return path;
+}
+
+/* try to create the program from the cache; returns GL_NONE on failure */
+static GLuint cache_load(struct gl_shader *shader, const char *path,
+			 uint64_t key)
+{
+	struct cache_header h;
+	void *data;
+	FILE *f;
+	GLuint program;
+	GLint status = GL_FALSE;
+
+	f = fopen(path, "rb");
+	if (!f)
+		return GL_NONE;
+
+	if (fread(&h, sizeof(h), 1, f) != 1 || h.magic != CACHE_MAGIC ||
+	    h.version != CACHE_VERSION || h.key != key || !h.length) {
+		fclose(f);
+		goto err_invalid;
+	}
+
+	data = malloc(h.length);
+	if (!data) {
+		fclose(f);
+		return GL_NONE;
+	}
+
+	if (fread(data, h.length, 1, f) != 1) {
+		free(data);
+		fclose(f);
+		goto err_invalid;
+	}
+	fclose(f);
+
+	gl_clear_error();
+	program = glCreateProgram();
+	glProgramBinaryOES(program, h.format, data, h.length);
+	free(data);
+
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	if (status == GL_FALSE || glGetError() != GL_NO_ERROR) {
+		gl_clear_error();
+		glDeleteProgram(program);
+		goto err_invalid;
+	}
+
+	llog_debug(shader, "loaded program from cache %s", path);
+	return program;
+
+err_invalid:
+	/* the driver rejects binaries of other versions so just drop it */
+	llog_debug(shader, "dropping stale program cache %s", path);
+	unlink(path);
+	return GL_NONE;
+}
+
+static void cache_store(struct gl_shader *shader, const char *path,
+			uint64_t key)
+{
+	struct cache_header h;
+	GLint len = 0;
+	GLsizei size = 0;
+	GLenum format = 0;
+	void *data;
+	char *tmp;
+	FILE *f;
+	int ret;
+
+	glGetProgramiv(shader->program, GL_PROGRAM_BINARY_LENGTH_OES, &len);
+	if (len <= 0)
+		return;
+
+	data = malloc(len);
+	if (!data)
+		return;
+
+	glGetProgramBinaryOES(shader->program, len, &size, &format, data);
+	if (glGetError() != GL_NO_ERROR || size <= 0) {
+		gl_clear_error();
+		goto out_data;
+	}
+
+	/* each VT runs its own instance so never share the temporary file */
+	ret = shl_open_tmp(path, "gl", &f, &tmp);
+	if (ret) {
+		llog_debug(shader, "cannot write program cache %s (%d)",
+			   path, ret);
+		goto out_data;
+	}
+
+	memset(&h, 0, sizeof(h));
+	h.magic = CACHE_MAGIC;
+	h.version = CACHE_VERSION;
+	h.key = key;
+	h.format = format;
+	h.length = size;
+
+	if (fwrite(&h, sizeof(h), 1, f) != 1 ||
+	    fwrite(data, size, 1, f) != 1) {
+		fclose(f);
+		unlink(tmp);
+		goto out_tmp;
+	}
+
+	if (fclose(f) || rename(tmp, path)) {
+		unlink(tmp);
+		goto out_tmp;
+	}
+
+	llog_debug(shader, "stored program in cache %s", path);
+
+out_tmp:
+	free(tmp);
+out_data:
+	free(data);
+}
+
+#else /* GL_OES_get_program_binary */
+
+static char *cache_path(const char *vert, int vert_len,
+			const char *frag, int frag_len,
+			char **attr, size_t attr_count, uint64_t *key)
+{
+	return NULL;
+}
+
+static GLuint cache_load(struct gl_shader *shader, const char *path,
+			 uint64_t key)
+{
+	return GL_NONE;
+}
+
+static void cache_store(struct gl_shader *shader, const char *path,
+			uint64_t key)
+{
+}
+
+#endif /* GL_OES_get_program_binary */
+
 int gl_shader_new(struct gl_shader **out, const char *vert, int vert_len,
 		  const char *frag, int frag_len,
 		  char **attr, size_t attr_count, llog_submit_t llog,
@@ -142,6 +368,8 @@ int gl_shader_new(struct gl_shader **out, const char *vert, int vert_len,
 	int ret, i;
 	char msg[512];
 	GLint status = 1;
+	char *path;
+	uint64_t key = 0;
 
 	if (!out || !vert || !frag)
 		return -EINVAL;
@@ -156,6 +384,17 @@ int gl_shader_new(struct gl_shader **out, const char *vert, int vert_len,
 
 	llog_debug(shader, "new shader");
 
+	path = cache_path(vert, vert_len, frag, frag_len, attr, attr_count,
+			  &key);
+	if (path) {
+		shader->program = cache_load(shader, path, key);
+		if (shader->program != GL_NONE) {
+			free(path);
+			*out = shader;
+			return 0;
+		}
+	}
+
 	shader->vshader = compile_shader(shader, GL_VERTEX_SHADER, vert,
 					 vert_len);
 	if (shader->vshader == GL_NONE) {
@@ -193,6 +432,11 @@ int gl_shader_new(struct gl_shader **out, const char *vert, int vert_len,
 		goto err_link;
 	}
 
+	if (path) {
+		cache_store(shader, path, key);
+		free(path);
+	}
+
 	*out = shader;
 	return 0;
 
@@ -202,6 +446,7 @@ err_link:
 err_vshader:
 	glDeleteShader(shader->vshader);
 err_free:
+	free(path);
 	free(shader);
 	return ret;
 }
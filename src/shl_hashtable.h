@@ -165,6 +165,11 @@ static inline void shl_hashtable_remove(struct shl_hashtable *tbl, void *key)
 	     entry = htable_nextval(&tbl->tbl, &i, hash)) {
 		if (tbl->equal_cb(key, entry->key)) {
 			htable_delval(&tbl->tbl, &i);
+			if (tbl->free_key)
+				tbl->free_key(entry->key);
+			if (tbl->free_value)
+				tbl->free_value(entry->value);
+			free(entry);
 			return;
 		}
 	}
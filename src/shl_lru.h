@@ -0,0 +1,158 @@
+/*
+ * shl - Bounded LRU Accounting
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Bounded LRU accounting
+ * This keeps intrusive entries in least-recently-used order together with
+ * their size and the epoch they were last used in. It does not own the
+ * entries; the user looks up victims with shl_lru_victim(), evicts them with
+ * shl_lru_evict() and then frees them itself. Entries that were used in the
+ * current epoch are never returned as victims, so a cache may temporarily
+ * grow beyond its limit if a single epoch uses more than fits into it.
+ * A limit of 0 disables eviction.
+ *
+ * Lock-free lookup paths can use shl_lru_mark() which only updates the epoch of
+ * an entry. Such entries are not reordered, instead shl_lru_victim() gives them
+ * a second chance and moves them to the front if they were used in the current
+ * epoch. As marks race with serialized lookups, the hit counter is updated
+ * atomically and must be read with shl_lru_get_hits(). All other functions must
+ * be serialized by the user.
+ */
+
+#ifndef SHL_LRU_H
+#define SHL_LRU_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "shl_dlist.h"
+
+/* number of recently marked entries shl_lru_victim() skips at most */
+#define SHL_LRU_SCAN 32
+
+struct shl_lru_entry {
+	struct shl_dlist list;
+	size_t size;
+	unsigned long epoch;
+};
+
+struct shl_lru {
+	struct shl_dlist list;
+	size_t size;
+	size_t limit;
+	unsigned long entries;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+};
+
+static inline void shl_lru_init(struct shl_lru *lru, size_t limit)
+{
+	shl_dlist_init(&lru->list);
+	lru->size = 0;
+	lru->limit = limit;
+	lru->entries = 0;
+	lru->hits = 0;
+	lru->misses = 0;
+	lru->evictions = 0;
+}
+
+static inline void shl_lru_add(struct shl_lru *lru,
+			       struct shl_lru_entry *entry,
+			       size_t size, unsigned long epoch)
+{
+	entry->size = size;
+	entry->epoch = epoch;
+	shl_dlist_link(&lru->list, &entry->list);
+	lru->size += size;
+	++lru->entries;
+	++lru->misses;
+}
+
+static inline void shl_lru_touch(struct shl_lru *lru,
+				 struct shl_lru_entry *entry,
+				 unsigned long epoch)
+{
+	__atomic_store_n(&entry->epoch, epoch, __ATOMIC_RELAXED);
+	shl_dlist_unlink(&entry->list);
+	shl_dlist_link(&lru->list, &entry->list);
+	__atomic_add_fetch(&lru->hits, 1, __ATOMIC_RELAXED);
+}
+
+static inline void shl_lru_mark(struct shl_lru *lru,
+				struct shl_lru_entry *entry,
+				unsigned long epoch)
+{
+	__atomic_store_n(&entry->epoch, epoch, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&lru->hits, 1, __ATOMIC_RELAXED);
+}
+
+static inline unsigned long shl_lru_get_hits(struct shl_lru *lru)
+{
+	return __atomic_load_n(&lru->hits, __ATOMIC_RELAXED);
+}
+
+static inline void shl_lru_remove(struct shl_lru *lru,
+				  struct shl_lru_entry *entry)
+{
+	shl_dlist_unlink(&entry->list);
+	lru->size -= entry->size;
+	--lru->entries;
+}
+
+static inline void shl_lru_evict(struct shl_lru *lru,
+				 struct shl_lru_entry *entry)
+{
+	shl_lru_remove(lru, entry);
+	++lru->evictions;
+}
+
+static inline struct shl_lru_entry *shl_lru_victim(struct shl_lru *lru,
+						   unsigned long epoch)
+{
+	struct shl_lru_entry *entry;
+	unsigned int i;
+
+	if (!lru->limit || lru->size <= lru->limit)
+		return NULL;
+
+	for (i = 0; i < SHL_LRU_SCAN; ++i) {
+		if (shl_dlist_empty(&lru->list))
+			break;
+
+		entry = shl_dlist_last(&lru->list, struct shl_lru_entry, list);
+		if (__atomic_load_n(&entry->epoch, __ATOMIC_RELAXED) < epoch)
+			return entry;
+
+		/* used in this epoch, give it a second chance */
+		shl_dlist_unlink(&entry->list);
+		shl_dlist_link(&lru->list, &entry->list);
+	}
+
+	return NULL;
+}
+
+#endif /* SHL_LRU_H */
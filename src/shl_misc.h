@@ -33,6 +33,7 @@
 
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -40,6 +41,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 #include <unistd.h>
 #include <xkbcommon/xkbcommon.h>
 
@@ -329,6 +332,91 @@ err_close:
 	return ret;
 }
 
+/* creates @path and all missing parent directories */
+static inline int shl_mkdir_p(const char *path, mode_t mode)
+{
+	char *dir, *p;
+	int ret = 0;
+
+	if (!path || !*path)
+		return -EINVAL;
+
+	dir = strdup(path);
+	if (!dir)
+		return -ENOMEM;
+
+	for (p = dir + 1; *p; ++p) {
+		if (*p != '/')
+			continue;
+		*p = 0;
+		if (mkdir(dir, mode) && errno != EEXIST) {
+			ret = -errno;
+			*p = '/';
+			break;
+		}
+		*p = '/';
+	}
+
+	if (!ret && mkdir(dir, mode) && errno != EEXIST)
+		ret = -errno;
+
+	free(dir);
+	return ret;
+}
+
+/*
+ * Creates a new file with a unique name in the directory of @path, creating the
+ * directory if needed. The file is opened for writing in @out and its name is
+ * stored in @name, which must be freed by the caller. Write the data into it
+ * and rename() it over @path, so concurrent writers never share a file and
+ * readers never see partial data.
+ */
+static inline int shl_open_tmp(const char *path, const char *prefix,
+			       FILE **out, char **name)
+{
+	const char *slash;
+	size_t len;
+	char *tmp;
+	FILE *f;
+	int fd, ret;
+
+	if (!path || !prefix || !out || !name)
+		return -EINVAL;
+
+	slash = strrchr(path, '/');
+	if (!slash || slash == path)
+		return -EINVAL;
+	len = slash - path;
+
+	ret = asprintf(&tmp, "%.*s/%s-XXXXXX", (int)len, path, prefix);
+	if (ret < 0)
+		return -ENOMEM;
+
+	tmp[len] = 0;
+	shl_mkdir_p(tmp, 0700);
+	tmp[len] = '/';
+
+	fd = mkostemp(tmp, O_CLOEXEC);
+	if (fd < 0) {
+		ret = -errno;
+		free(tmp);
+		return ret;
+	}
+
+	f = fdopen(fd, "wb");
+	if (!f) {
+		ret = -errno;
+		close(fd);
+		unlink(tmp);
+		free(tmp);
+		return ret;
+	}
+
+	*out = f;
+	*name = tmp;
+	return 0;
+}
+
 /* TODO: xkbcommon should provide these flags!
  * We currently copy them into each library API we use so we need  to keep
  * them in sync. Currently, they're used in uterm-input and tsm-vte. */
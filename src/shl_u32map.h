@@ -0,0 +1,232 @@
+/*
+ * shl - uint32_t keyed hashtable
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * uint32_t keyed hashtable
+ * Open-addressing hashtable with Robin Hood probing. Keys and value pointers are
+ * stored inline in a single array so lookups do not chase any pointers. Each
+ * slot stores its distance to the slot its key hashes to, which bounds
+ * unsuccessful lookups and allows deletion by shifting the following slots
+ * back instead of using tombstones.
+ *
+ * SHL_U32MAP_DEFINE(name, type) generates "struct name" mapping uint32_t keys
+ * to "type *" values plus static inline functions prefixed with "name_". The
+ * map does not own its values. NULL values cannot be stored. A map is empty
+ * when zero-initialized or after name_init() and allocates memory on the first
+ * insertion only.
+ */
+
+#ifndef SHL_U32MAP_H
+#define SHL_U32MAP_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SHL_U32MAP_MIN_BITS 4
+
+/* fibonacci hashing; the upper bits of the product are well distributed */
+static inline uint32_t shl_u32map_hash(uint32_t key, unsigned int bits)
+{
+	return (uint32_t)(key * 2654435769U) >> (32 - bits);
+}
+
+#define SHL_U32MAP_DEFINE(name, type) \
+\
+struct name##_slot { \
+	uint32_t key; \
+	uint32_t dist; \
+	type *value; \
+}; \
+\
+struct name { \
+	struct name##_slot *slots; \
+	unsigned int bits; \
+	size_t num; \
+}; \
+\
+static inline void name##_init(struct name *map) \
+{ \
+	memset(map, 0, sizeof(*map)); \
+} \
+\
+static inline void name##_clear(struct name *map, void (*free_cb) (type *)) \
+{ \
+	size_t i, size; \
+\
+	if (map->slots && free_cb) { \
+		size = (size_t)1 << map->bits; \
+		for (i = 0; i < size; ++i) { \
+			if (map->slots[i].dist) \
+				free_cb(map->slots[i].value); \
+		} \
+	} \
+\
+	free(map->slots); \
+	memset(map, 0, sizeof(*map)); \
+} \
+\
+static inline type *name##_find(const struct name *map, uint32_t key) \
+{ \
+	const struct name##_slot *slot; \
+	uint32_t mask, idx, dist; \
+\
+	if (!map->num) \
+		return NULL; \
+\
+	mask = ((uint32_t)1 << map->bits) - 1; \
+	idx = shl_u32map_hash(key, map->bits); \
+	for (dist = 1; ; ++dist) { \
+		slot = &map->slots[idx]; \
+		if (slot->dist < dist) \
+			return NULL; \
+		if (slot->key == key) \
+			return slot->value; \
+		idx = (idx + 1) & mask; \
+	} \
+} \
+\
+static inline void name##__place(struct name *map, uint32_t key, type *value) \
+{ \
+	struct name##_slot cur, tmp, *slot; \
+	uint32_t mask, idx; \
+\
+	mask = ((uint32_t)1 << map->bits) - 1; \
+	idx = shl_u32map_hash(key, map->bits); \
+	cur.key = key; \
+	cur.dist = 1; \
+	cur.value = value; \
+\
+	while (true) { \
+		slot = &map->slots[idx]; \
+		if (!slot->dist) { \
+			*slot = cur; \
+			break; \
+		} \
+		if (slot->dist < cur.dist) { \
+			tmp = *slot; \
+			*slot = cur; \
+			cur = tmp; \
+		} \
+		idx = (idx + 1) & mask; \
+		++cur.dist; \
+	} \
+\
+	++map->num; \
+} \
+\
+static inline int name##__grow(struct name *map) \
+{ \
+	struct name##_slot *old; \
+	unsigned int bits; \
+	size_t i, size; \
+\
+	old = map->slots; \
+	bits = old ? map->bits + 1 : SHL_U32MAP_MIN_BITS; \
+	if (bits > 31) \
+		return -ENOMEM; \
+\
+	map->slots = calloc((size_t)1 << bits, sizeof(*map->slots)); \
+	if (!map->slots) { \
+		map->slots = old; \
+		return -ENOMEM; \
+	} \
+\
+	size = old ? (size_t)1 << map->bits : 0; \
+	map->bits = bits; \
+	map->num = 0; \
+	for (i = 0; i < size; ++i) { \
+		if (old[i].dist) \
+			name##__place(map, old[i].key, old[i].value); \
+	} \
+\
+	free(old); \
+	return 0; \
+} \
+\
+/* returns -EALREADY if @key is already present */ \
+static inline int name##_insert(struct name *map, uint32_t key, type *value) \
+{ \
+	int ret; \
+\
+	if (!value) \
+		return -EINVAL; \
+	if (name##_find(map, key)) \
+		return -EALREADY; \
+\
+	/* keep the load factor below 7/8 */ \
+	if (!map->slots || \
+	    (map->num + 1) * 8 > ((size_t)7 << map->bits)) { \
+		ret = name##__grow(map); \
+		if (ret) \
+			return ret; \
+	} \
+\
+	name##__place(map, key, value); \
+	return 0; \
+} \
+\
+/* removes @key and returns its value, NULL if it was not present */ \
+static inline type *name##_remove(struct name *map, uint32_t key) \
+{ \
+	struct name##_slot *slot, *next; \
+	uint32_t mask, idx, dist; \
+	type *value; \
+\
+	if (!map->num) \
+		return NULL; \
+\
+	mask = ((uint32_t)1 << map->bits) - 1; \
+	idx = shl_u32map_hash(key, map->bits); \
+	for (dist = 1; ; ++dist) { \
+		slot = &map->slots[idx]; \
+		if (slot->dist < dist) \
+			return NULL; \
+		if (slot->key == key) \
+			break; \
+		idx = (idx + 1) & mask; \
+	} \
+\
+	value = slot->value; \
+\
+	/* shift following displaced slots back by one */ \
+	while (true) { \
+		next = &map->slots[(idx + 1) & mask]; \
+		if (next->dist <= 1) \
+			break; \
+		*slot = *next; \
+		--slot->dist; \
+		idx = (idx + 1) & mask; \
+		slot = next; \
+	} \
+\
+	slot->dist = 0; \
+	--map->num; \
+	return value; \
+}
+
+#endif /* SHL_U32MAP_H */
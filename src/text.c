@@ -212,6 +212,109 @@ void kmscon_text_unref(struct kmscon_text *text)
 	free(text);
 }
 
+/* Row hashes of the frame in history slot @slot. The slot after the last one
+ * holds the hashes of the frame that is currently drawn. */
+static inline uint64_t *frame_hashes(struct kmscon_text *txt,
+				     unsigned int slot)
+{
+	return &txt->hashes[slot * txt->rows];
+}
+
+static inline uint64_t mix64(uint64_t v)
+{
+	v ^= v >> 30;
+	v *= 0xbf58476d1ce4e5b9ULL;
+	v ^= v >> 27;
+	v *= 0x94d049bb133111ebULL;
+	v ^= v >> 31;
+	return v;
+}
+
+/* Add a cell to the hash of its row. The cells are summed up so the order in
+ * which they are drawn does not matter, but the column is part of each cell
+ * hash. Everything that changes the pixels of the cell must be included. */
+static void hash_cell(struct kmscon_text *txt, uint32_t id, size_t len,
+		      unsigned int width, unsigned int posx, unsigned int posy,
+		      const struct tsm_screen_attr *attr)
+{
+	uint64_t cell, col, *row = &frame_hashes(txt, KMSCON_TEXT_HISTORY)[posy];
+
+	if (len > 0xff)
+		len = 0xff;
+
+	cell = (uint64_t)id << 32;
+	cell |= (uint64_t)len << 24;
+	cell |= (uint64_t)(width & 0xff) << 16;
+	cell |= posx & 0xffff;
+
+	col = (uint64_t)attr->fr << 40 | (uint64_t)attr->fg << 32 |
+	      (uint64_t)attr->fb << 24 | (uint64_t)attr->br << 16 |
+	      (uint64_t)attr->bg << 8 | (uint64_t)attr->bb;
+	col |= (uint64_t)attr->bold << 48;
+	col |= (uint64_t)attr->underline << 49;
+	col |= (uint64_t)attr->inverse << 50;
+	col |= (uint64_t)attr->blink << 51;
+
+	*row += mix64(cell ^ mix64(col));
+}
+
+/* Swap the fonts of @txt without resetting the backend. On failure, the caller
+ * must do a full kmscon_text_unset() and set. */
+static int rescale(struct kmscon_text *txt, struct kmscon_font *font,
+		   struct kmscon_font *bold_font)
+{
+	struct kmscon_font *old_font = txt->font, *old_bold = txt->bold_font;
+	struct uterm_video_rect *damage;
+	struct kmscon_text_cell *cells;
+	struct kmscon_font_req *reqs;
+	uint64_t *hashes;
+	unsigned int cols = txt->cols, rows = txt->rows;
+	int ret;
+
+	txt->font = font;
+	txt->bold_font = bold_font;
+	ret = txt->ops->rescale(txt);
+	if (ret) {
+		txt->font = old_font;
+		txt->bold_font = old_bold;
+		txt->cols = cols;
+		txt->rows = rows;
+		return ret;
+	}
+
+	kmscon_font_ref(font);
+	kmscon_font_ref(bold_font);
+	kmscon_font_unref(old_font);
+	kmscon_font_unref(old_bold);
+	memset(txt->history, 0, sizeof(txt->history));
+
+	if (txt->cols * txt->rows <= cols * rows && txt->rows <= rows)
+		return 0;
+
+	damage = malloc(sizeof(*damage) * (txt->rows + 1));
+	cells = malloc(sizeof(*cells) * txt->cols * txt->rows);
+	reqs = malloc(sizeof(*reqs) * txt->cols * txt->rows);
+	hashes = malloc(sizeof(*hashes) * txt->rows *
+			(KMSCON_TEXT_HISTORY + 1));
+	if (!damage || !cells || !reqs || !hashes) {
+		free(hashes);
+		free(reqs);
+		free(cells);
+		free(damage);
+		return -ENOMEM;
+	}
+
+	free(txt->hashes);
+	free(txt->reqs);
+	free(txt->cells);
+	free(txt->damage);
+	txt->hashes = hashes;
+	txt->reqs = reqs;
+	txt->cells = cells;
+	txt->damage = damage;
+	return 0;
+}
+
 /**
  * kmscon_text_set:
  * @txt: Valid text-renderer object
@@ -228,6 +331,8 @@ void kmscon_text_unref(struct kmscon_text *text)
  * If @bold_font is NULL, @font is also used for bold characters. The caller
  * must make sure that @font and @bold_font have the same metrics. The renderers
  * will always use the metrics of @font.
+ * If only the fonts change, backends that can scale their glyphs keep their
+ * state and merely adapt to the new metrics.
  *
  * Returns: 0 on success, negative error code on failure.
  */
@@ -244,11 +349,17 @@ int kmscon_text_set(struct kmscon_text *txt,
 	if (!bold_font)
 		bold_font = font;
 
+	if (txt->disp == disp && txt->font && txt->ops->rescale &&
+	    !rescale(txt, font, bold_font))
+		return 0;
+
 	kmscon_text_unset(txt);
 
 	txt->font = font;
 	txt->bold_font = bold_font;
 	txt->disp = disp;
+	txt->can_move = false;
+	memset(txt->history, 0, sizeof(txt->history));
 
 	if (txt->ops->set) {
 		ret = txt->ops->set(txt);
@@ -260,6 +371,30 @@ int kmscon_text_set(struct kmscon_text *txt,
 		}
 	}
 
+	txt->damage = malloc(sizeof(*txt->damage) * (txt->rows + 1));
+	txt->cells = malloc(sizeof(*txt->cells) * txt->cols * txt->rows);
+	txt->reqs = malloc(sizeof(*txt->reqs) * txt->cols * txt->rows);
+	txt->hashes = malloc(sizeof(*txt->hashes) * txt->rows *
+			     (KMSCON_TEXT_HISTORY + 1));
+	if (!txt->damage || !txt->cells || !txt->reqs || !txt->hashes) {
+		free(txt->hashes);
+		free(txt->reqs);
+		free(txt->cells);
+		free(txt->damage);
+		txt->hashes = NULL;
+		txt->reqs = NULL;
+		txt->cells = NULL;
+		txt->damage = NULL;
+		if (txt->ops->unset)
+			txt->ops->unset(txt);
+		txt->font = NULL;
+		txt->bold_font = NULL;
+		txt->disp = NULL;
+		txt->cols = 0;
+		txt->rows = 0;
+		return -ENOMEM;
+	}
+
 	kmscon_font_ref(txt->font);
 	kmscon_font_ref(txt->bold_font);
 	uterm_display_ref(txt->disp);
@@ -284,6 +419,14 @@ void kmscon_text_unset(struct kmscon_text *txt)
 	if (txt->ops->unset)
 		txt->ops->unset(txt);
 
+	free(txt->hashes);
+	free(txt->reqs);
+	free(txt->cells);
+	free(txt->damage);
+	txt->hashes = NULL;
+	txt->reqs = NULL;
+	txt->cells = NULL;
+	txt->damage = NULL;
 	kmscon_font_unref(txt->font);
 	kmscon_font_unref(txt->bold_font);
 	uterm_display_unref(txt->disp);
@@ -333,6 +476,50 @@ unsigned int kmscon_text_get_rows(struct kmscon_text *txt)
 	return txt->rows;
 }
 
+/**
+ * kmscon_text_get_stats:
+ * @txt: valid text renderer
+ * @stats: Output buffer for the statistics
+ *
+ * Renderers that keep their own copies of glyphs (like textures or converted
+ * images) bound them by kmscon_font_get_cache_limit(). This returns the
+ * occupancy and the counters of these caches.
+ *
+ * Returns: 0 on success, -EOPNOTSUPP if the renderer has no glyph cache
+ */
+int kmscon_text_get_stats(struct kmscon_text *txt,
+			  struct kmscon_glyph_stats *stats)
+{
+	if (!txt || !stats)
+		return -EINVAL;
+
+	if (!txt->ops->get_stats)
+		return -EOPNOTSUPP;
+
+	memset(stats, 0, sizeof(*stats));
+	txt->ops->get_stats(txt, stats);
+	return 0;
+}
+
+/**
+ * kmscon_text_flush:
+ * @txt: valid text renderer
+ *
+ * This drops all glyphs the renderer copied from its fonts and forces the next
+ * frame to be redrawn completely. Use it if glyphs that the fonts returned
+ * earlier were replaced, like the provisional glyphs of interim fonts. This
+ * must not be called during a rendering-round.
+ */
+void kmscon_text_flush(struct kmscon_text *txt)
+{
+	if (!txt || !txt->font || txt->rendering)
+		return;
+
+	if (txt->ops->flush)
+		txt->ops->flush(txt);
+	memset(txt->history, 0, sizeof(txt->history));
+}
+
 /**
  * kmscon_text_prepare:
  * @txt: valid text renderer
@@ -344,22 +531,67 @@ unsigned int kmscon_text_get_rows(struct kmscon_text *txt)
  * between, you need to restart rendering by calling kmscon_text_prepare() again
  * and redoing everything from the beginning.
  *
+ * If the display keeps the content of its back-buffers, only the cells that
+ * changed since the frame in the current back-buffer was rendered are passed
+ * to the backend by kmscon_text_draw_cb(). This requires that the screen-age of
+ * each frame is reported via kmscon_text_set_age(). If rows of that frame were
+ * only shifted, like when the console scrolled, and the backend can move rows,
+ * they are moved inside the back-buffer instead of being redrawn.
+ *
  * Returns: 0 on success, negative error code on failure.
  */
 int kmscon_text_prepare(struct kmscon_text *txt)
 {
-	int ret = 0;
+	int ret = 0, age;
+	unsigned int i;
+	struct kmscon_text_frame *frame;
 
 	if (!txt || !txt->font || !txt->disp)
 		return -EINVAL;
 
+	/* glyphs of previous frames are not referenced anymore */
+	kmscon_font_next_epoch();
+
 	txt->rendering = true;
 	if (txt->ops->prepare)
 		ret = txt->ops->prepare(txt);
-	if (ret)
+	if (ret) {
 		txt->rendering = false;
+		return ret;
+	}
 
-	return ret;
+	txt->skip = false;
+	txt->skip_hashes = NULL;
+	txt->has_age = false;
+	age = uterm_display_get_buffer_age(txt->disp, &txt->seq);
+	txt->has_seq = age >= 0;
+	if (age > 0) {
+		i = (txt->seq - age) % KMSCON_TEXT_HISTORY;
+		frame = &txt->history[i];
+		if (frame->valid && frame->seq == txt->seq - age) {
+			txt->skip = true;
+			txt->skip_age = frame->age;
+			txt->skip_hashes = frame_hashes(txt, i);
+		}
+	}
+
+	memset(frame_hashes(txt, KMSCON_TEXT_HISTORY), 0,
+	       sizeof(*txt->hashes) * txt->rows);
+	txt->moved_start = 0;
+	txt->moved_end = 0;
+
+	for (i = 0; i < txt->rows; ++i) {
+		txt->damage[i].x = txt->cols;
+		txt->damage[i].width = 0;
+	}
+
+	/* rows can only be moved before any cell of the frame is drawn */
+	txt->cell_num = 0;
+	txt->defer = txt->font->ops->render_batch ||
+		     txt->bold_font->ops->render_batch ||
+		     (txt->skip && txt->can_move);
+
+	return 0;
 }
 
 /**
@@ -378,6 +610,10 @@ int kmscon_text_prepare(struct kmscon_text *txt)
  * kmscon_text_prepare(). Use this function to feed all glyphs into the
  * rendering pipeline and finally call kmscon_text_render().
  *
+ * If one of the fonts supports batched rendering, the cell is only recorded
+ * here and passed to the backend in kmscon_text_render() after all missing
+ * glyphs of the frame were requested from the fonts at once.
+ *
  * Returns: 0 on success or negative error code if this glyph couldn't be drawn.
  */
 int kmscon_text_draw(struct kmscon_text *txt,
@@ -386,14 +622,226 @@ int kmscon_text_draw(struct kmscon_text *txt,
 		     unsigned int posx, unsigned int posy,
 		     const struct tsm_screen_attr *attr)
 {
+	struct kmscon_text_cell *cell;
+
 	if (!txt || !txt->rendering)
 		return -EINVAL;
 	if (posx >= txt->cols || posy >= txt->rows || !attr)
 		return -EINVAL;
 
+	hash_cell(txt, id, len, width, posx, posy, attr);
+	if (txt->damage[posy].x > posx)
+		txt->damage[posy].x = posx;
+	if (txt->damage[posy].width < posx + width)
+		txt->damage[posy].width = posx + width;
+
+	if (txt->defer && txt->cell_num < txt->cols * txt->rows) {
+		cell = &txt->cells[txt->cell_num++];
+		cell->id = id;
+		cell->ch = ch;
+		cell->len = len;
+		cell->width = width;
+		cell->posx = posx;
+		cell->posy = posy;
+		memcpy(&cell->attr, attr, sizeof(*attr));
+		return 0;
+	}
+
 	return txt->ops->draw(txt, id, ch, len, width, posx, posy, attr);
 }
 
+/**
+ * kmscon_text_set_age:
+ * @txt: valid text renderer
+ * @age: screen-age as returned by tsm_screen_draw()
+ *
+ * This records the age of the screen that is drawn in the current
+ * rendering-round. It is used to skip unchanged cells if the frame is still
+ * present in a back-buffer later. It must be called before kmscon_text_render().
+ */
+void kmscon_text_set_age(struct kmscon_text *txt, tsm_age_t age)
+{
+	if (!txt || !txt->rendering)
+		return;
+
+	txt->has_age = true;
+	txt->age = age;
+}
+
+/* Report the drawn cells as damage of a partial frame. During drawing, the
+ * damage array stores the first and last+1 column per row, so we can convert
+ * it into pixel-rectangles in-place. */
+static void set_damage(struct kmscon_text *txt)
+{
+	struct uterm_video_rect *rect;
+	unsigned int i, num = 0, fw, fh, x1, x2;
+
+	if (!txt->skip) {
+		uterm_display_set_damage(txt->disp, NULL, 0);
+		return;
+	}
+
+	fw = txt->font->attr.width;
+	fh = txt->font->attr.height;
+	for (i = 0; i < txt->rows; ++i) {
+		x1 = txt->damage[i].x;
+		x2 = txt->damage[i].width;
+		if (x1 >= x2)
+			continue;
+
+		rect = &txt->damage[num++];
+		rect->x = x1 * fw;
+		rect->y = i * fh;
+		rect->width = (x2 - x1) * fw;
+		rect->height = fh;
+	}
+
+	/* nothing changed at all; report a tiny region so the swap does not
+	 * fall back to a full update */
+	if (!num) {
+		txt->damage[0].x = 0;
+		txt->damage[0].y = 0;
+		txt->damage[0].width = 1;
+		txt->damage[0].height = 1;
+		num = 1;
+	}
+
+	uterm_display_set_damage(txt->disp, txt->damage, num);
+}
+
+/* Request all glyphs of deferred cells from @font in one batch. Fonts without
+ * batch support simply ignore it. */
+static void render_batch(struct kmscon_text *txt, struct kmscon_font *font,
+			 bool bold)
+{
+	struct kmscon_text_cell *cell;
+	size_t i, num = 0;
+	int ret;
+
+	if (!font->ops->render_batch)
+		return;
+
+	for (i = 0; i < txt->cell_num; ++i) {
+		cell = &txt->cells[i];
+		if (!cell->len)
+			continue;
+		if (txt->font != txt->bold_font && cell->attr.bold != bold)
+			continue;
+		/* drawn by kmscon_font_render() without the backend */
+		if (cell->len == 1 && kmscon_font_box_covers(*cell->ch))
+			continue;
+
+		txt->reqs[num].id = cell->id;
+		txt->reqs[num].ch = cell->ch;
+		txt->reqs[num].len = cell->len;
+		++num;
+	}
+
+	ret = kmscon_font_render_batch(font, txt->reqs, num);
+	if (ret)
+		log_debug("cannot batch glyph rendering (%d)", ret);
+}
+
+/* Pass all deferred cells to the backend. The cell data stays valid until
+ * kmscon_text_render() is called as the screen is not modified in between.
+ * Like with direct drawing, cells that cannot be drawn are skipped, but the
+ * first error is returned so the frame is not recorded as complete. */
+static int flush_cells(struct kmscon_text *txt)
+{
+	struct kmscon_text_cell *cell;
+	size_t i;
+	int ret, err = 0;
+
+	if (!txt->cell_num)
+		return 0;
+
+	render_batch(txt, txt->font, false);
+	if (txt->bold_font != txt->font)
+		render_batch(txt, txt->bold_font, true);
+
+	for (i = 0; i < txt->cell_num; ++i) {
+		cell = &txt->cells[i];
+		if (cell->posy >= txt->moved_start &&
+		    cell->posy < txt->moved_end)
+			continue;
+		ret = txt->ops->draw(txt, cell->id, cell->ch, cell->len,
+				     cell->width, cell->posx, cell->posy,
+				     &cell->attr);
+		if (ret && !err) {
+			log_debug("cannot draw cell %u/%u (%d)", cell->posx,
+				  cell->posy, ret);
+			err = ret;
+		}
+	}
+
+	txt->cell_num = 0;
+	return err;
+}
+
+/* Compare the row hashes of the current frame with the frame in the back-buffer
+ * and find the shift that leaves the most changed rows without redraw. The
+ * matching rows are moved inside the back-buffer and their deferred cells are
+ * dropped in flush_cells(). Rows with equal hashes are assumed to be equal. */
+static void move_rows(struct kmscon_text *txt)
+{
+	const uint64_t *old = txt->skip_hashes;
+	const uint64_t *cur = frame_hashes(txt, KMSCON_TEXT_HISTORY);
+	int rows = txt->rows, d, r, lo, hi, start, gain, ret;
+	int best = 0, best_d = 0, best_start = 0, best_end = 0;
+
+	if (!old || !txt->can_move)
+		return;
+
+	for (r = 0; r < rows; ++r) {
+		if (cur[r] != old[r])
+			++best;
+	}
+
+	/* moving a single row does not pay off compared to redrawing it */
+	if (best < 2)
+		return;
+
+	best = 1;
+	for (d = 1 - rows; d < rows; ++d) {
+		if (!d)
+			continue;
+
+		lo = d < 0 ? -d : 0;
+		hi = d > 0 ? rows - d : rows;
+		start = lo;
+		gain = 0;
+		for (r = lo; r <= hi; ++r) {
+			if (r < hi && cur[r] == old[r + d]) {
+				if (cur[r] != old[r])
+					++gain;
+				continue;
+			}
+
+			if (gain > best) {
+				best = gain;
+				best_d = d;
+				best_start = start;
+				best_end = r;
+			}
+			start = r + 1;
+			gain = 0;
+		}
+	}
+
+	if (!best_d)
+		return;
+
+	ret = txt->ops->move_rows(txt, best_start, best_start + best_d,
+				  best_end - best_start);
+	if (ret) {
+		log_debug("cannot move rows (%d)", ret);
+		return;
+	}
+
+	txt->moved_start = best_start;
+	txt->moved_end = best_end;
+}
+
 /**
  * kmscon_text_render:
  * @txt: valid text renderer
@@ -405,16 +853,41 @@ int kmscon_text_draw(struct kmscon_text *txt,
  */
 int kmscon_text_render(struct kmscon_text *txt)
 {
-	int ret = 0;
+	int ret = 0, err;
+	struct kmscon_text_frame *frame;
 
 	if (!txt || !txt->rendering)
 		return -EINVAL;
 
+	move_rows(txt);
+	err = flush_cells(txt);
+	set_damage(txt);
+
+	/* finish the frame even if cells are missing but do not record it */
 	if (txt->ops->render)
 		ret = txt->ops->render(txt);
+	if (!ret)
+		ret = err;
 	txt->rendering = false;
 
-	return ret;
+	if (ret || !txt->has_seq || !txt->has_age)
+		return ret;
+
+	/* An age of 0 means the screen-age counter was reset so all ages we
+	 * recorded so far are no longer comparable. */
+	if (!txt->age) {
+		memset(txt->history, 0, sizeof(txt->history));
+	} else {
+		frame = &txt->history[txt->seq % KMSCON_TEXT_HISTORY];
+		frame->seq = txt->seq;
+		frame->age = txt->age;
+		frame->valid = true;
+		memcpy(frame_hashes(txt, txt->seq % KMSCON_TEXT_HISTORY),
+		       frame_hashes(txt, KMSCON_TEXT_HISTORY),
+		       sizeof(*txt->hashes) * txt->rows);
+	}
+
+	return 0;
 }
 
 /**
@@ -444,5 +917,15 @@ int kmscon_text_draw_cb(struct tsm_screen *con,
 			const struct tsm_screen_attr *attr,
 			tsm_age_t age, void *data)
 {
-	return kmscon_text_draw(data, id, ch, len, width, posx, posy, attr);
+	struct kmscon_text *txt = data;
+
+	/* cells with age 0 must always be redrawn; skipped cells are still part
+	 * of the row hashes */
+	if (txt && txt->rendering && txt->skip && age && age <= txt->skip_age) {
+		if (posx < txt->cols && posy < txt->rows && attr)
+			hash_cell(txt, id, len, width, posx, posy, attr);
+		return 0;
+	}
+
+	return kmscon_text_draw(txt, id, ch, len, width, posx, posy, attr);
 }
@@ -45,6 +45,24 @@
 struct kmscon_text;
 struct kmscon_text_ops;
 
+#define KMSCON_TEXT_HISTORY 4
+
+struct kmscon_text_frame {
+	unsigned long seq;
+	tsm_age_t age;
+	bool valid;
+};
+
+struct kmscon_text_cell {
+	uint32_t id;
+	const uint32_t *ch;
+	size_t len;
+	unsigned int width;
+	unsigned int posx;
+	unsigned int posy;
+	struct tsm_screen_attr attr;
+};
+
 struct kmscon_text {
 	unsigned long ref;
 	struct shl_register_record *record;
@@ -57,6 +75,30 @@ struct kmscon_text {
 	unsigned int cols;
 	unsigned int rows;
 	bool rendering;
+
+	/* partial redraw state */
+	bool has_seq;
+	unsigned long seq;
+	bool skip;
+	tsm_age_t skip_age;
+	bool has_age;
+	tsm_age_t age;
+	struct kmscon_text_frame history[KMSCON_TEXT_HISTORY];
+	struct uterm_video_rect *damage;
+
+	/* row hashes of each frame in history and of the current frame; rows
+	 * are only moved if the backend sets can_move in its set() op */
+	bool can_move;
+	uint64_t *hashes;
+	const uint64_t *skip_hashes;
+	unsigned int moved_start;
+	unsigned int moved_end;
+
+	/* deferred cells for batched glyph rendering */
+	bool defer;
+	struct kmscon_text_cell *cells;
+	size_t cell_num;
+	struct kmscon_font_req *reqs;
 };
 
 struct kmscon_text_ops {
@@ -74,6 +116,12 @@ struct kmscon_text_ops {
 		     const struct tsm_screen_attr *attr);
 	int (*render) (struct kmscon_text *txt);
 	void (*abort) (struct kmscon_text *txt);
+	void (*get_stats) (struct kmscon_text *txt,
+			   struct kmscon_glyph_stats *stats);
+	void (*flush) (struct kmscon_text *txt);
+	int (*rescale) (struct kmscon_text *txt);
+	int (*move_rows) (struct kmscon_text *txt, unsigned int dst,
+			  unsigned int src, unsigned int num);
 };
 
 int kmscon_text_register(const struct kmscon_text_ops *ops);
@@ -90,6 +138,9 @@ int kmscon_text_set(struct kmscon_text *txt,
 void kmscon_text_unset(struct kmscon_text *txt);
 unsigned int kmscon_text_get_cols(struct kmscon_text *txt);
 unsigned int kmscon_text_get_rows(struct kmscon_text *txt);
+int kmscon_text_get_stats(struct kmscon_text *txt,
+			  struct kmscon_glyph_stats *stats);
+void kmscon_text_flush(struct kmscon_text *txt);
 
 int kmscon_text_prepare(struct kmscon_text *txt);
 int kmscon_text_draw(struct kmscon_text *txt,
@@ -97,6 +148,7 @@ int kmscon_text_draw(struct kmscon_text *txt,
 		     unsigned int width,
 		     unsigned int posx, unsigned int posy,
 		     const struct tsm_screen_attr *attr);
+void kmscon_text_set_age(struct kmscon_text *txt, tsm_age_t age);
 int kmscon_text_render(struct kmscon_text *txt);
 void kmscon_text_abort(struct kmscon_text *txt);
 
@@ -112,6 +164,8 @@ int kmscon_text_draw_cb(struct tsm_screen *con,
 extern struct kmscon_text_ops kmscon_text_bblit_ops;
 extern struct kmscon_text_ops kmscon_text_bbulk_ops;
 extern struct kmscon_text_ops kmscon_text_gltex_ops;
+extern struct kmscon_text_ops kmscon_text_gltex_sdf_ops;
+extern struct kmscon_text_ops kmscon_text_gltex_grid_ops;
 extern struct kmscon_text_ops kmscon_text_pixman_ops;
 
 #endif /* KMSCON_TEXT_H */
@@ -57,6 +57,7 @@ static int bblit_set(struct kmscon_text *txt)
 
 	txt->cols = sw / fw;
 	txt->rows = sh / fh;
+	txt->can_move = uterm_display_can_copy(txt->disp);
 
 	return 0;
 }
@@ -70,6 +71,7 @@ static int bblit_draw(struct kmscon_text *txt,
 	const struct kmscon_glyph *glyph;
 	int ret;
 	struct kmscon_font *font;
+	struct uterm_video_blend_req req;
 
 	if (!width)
 		return 0;
@@ -91,22 +93,38 @@ static int bblit_draw(struct kmscon_text *txt,
 			return ret;
 	}
 
-	/* draw glyph */
+	/* draw glyph; only its ink box needs blending */
+	req.buf = &glyph->buf;
+	req.ink = &glyph->ink;
+	req.x = posx * txt->font->attr.width;
+	req.y = posy * txt->font->attr.height;
 	if (attr->inverse) {
-		ret = uterm_display_fake_blend(txt->disp, &glyph->buf,
-					       posx * txt->font->attr.width,
-					       posy * txt->font->attr.height,
-					       attr->br, attr->bg, attr->bb,
-					       attr->fr, attr->fg, attr->fb);
+		req.fr = attr->br;
+		req.fg = attr->bg;
+		req.fb = attr->bb;
+		req.br = attr->fr;
+		req.bg = attr->fg;
+		req.bb = attr->fb;
 	} else {
-		ret = uterm_display_fake_blend(txt->disp, &glyph->buf,
-					       posx * txt->font->attr.width,
-					       posy * txt->font->attr.height,
-					       attr->fr, attr->fg, attr->fb,
-					       attr->br, attr->bg, attr->bb);
+		req.fr = attr->fr;
+		req.fg = attr->fg;
+		req.fb = attr->fb;
+		req.br = attr->br;
+		req.bg = attr->bg;
+		req.bb = attr->bb;
 	}
 
-	return ret;
+	return uterm_display_fake_blendv(txt->disp, &req, 1);
+}
+
+static int bblit_move_rows(struct kmscon_text *txt, unsigned int dst,
+			   unsigned int src, unsigned int num)
+{
+	unsigned int fw = txt->font->attr.width;
+	unsigned int fh = txt->font->attr.height;
+
+	return uterm_display_copy(txt->disp, 0, src * fh, txt->cols * fw,
+				  num * fh, 0, dst * fh);
 }
 
 struct kmscon_text_ops kmscon_text_bblit_ops = {
@@ -120,4 +138,5 @@ struct kmscon_text_ops kmscon_text_bblit_ops = {
 	.draw = bblit_draw,
 	.render = NULL,
 	.abort = NULL,
+	.move_rows = bblit_move_rows,
 };
@@ -85,6 +85,7 @@ static int bbulk_set(struct kmscon_text *txt)
 
 	txt->cols = sw / FONT_WIDTH(txt);
 	txt->rows = sh / FONT_HEIGHT(txt);
+	txt->can_move = uterm_display_can_copy(txt->disp);
 
 	bb->reqs = malloc(sizeof(*bb->reqs) * txt->cols * txt->rows);
 	if (!bb->reqs)
@@ -110,6 +111,19 @@ static void bbulk_unset(struct kmscon_text *txt)
 	bb->reqs = NULL;
 }
 
+/* Only the cells passed in this frame are blended. All others either keep
+ * their content in the back-buffer or were moved by bbulk_move_rows(). */
+static int bbulk_prepare(struct kmscon_text *txt)
+{
+	struct bbulk *bb = txt->data;
+	unsigned int i;
+
+	for (i = 0; i < txt->cols * txt->rows; ++i)
+		bb->reqs[i].buf = NULL;
+
+	return 0;
+}
+
 static int bbulk_draw(struct kmscon_text *txt,
 		      uint32_t id, const uint32_t *ch, size_t len,
 		      unsigned int width,
@@ -146,6 +160,7 @@ static int bbulk_draw(struct kmscon_text *txt,
 
 	req = &bb->reqs[posy * txt->cols + posx];
 	req->buf = &glyph->buf;
+	req->ink = &glyph->ink;
 	if (attr->inverse) {
 		req->fr = attr->br;
 		req->fg = attr->bg;
@@ -173,6 +188,15 @@ static int bbulk_render(struct kmscon_text *txt)
 					 txt->cols * txt->rows);
 }
 
+static int bbulk_move_rows(struct kmscon_text *txt, unsigned int dst,
+			   unsigned int src, unsigned int num)
+{
+	return uterm_display_copy(txt->disp, 0, src * FONT_HEIGHT(txt),
+				  txt->cols * FONT_WIDTH(txt),
+				  num * FONT_HEIGHT(txt),
+				  0, dst * FONT_HEIGHT(txt));
+}
+
 struct kmscon_text_ops kmscon_text_bbulk_ops = {
 	.name = "bbulk",
 	.owner = NULL,
@@ -180,8 +204,9 @@ struct kmscon_text_ops kmscon_text_bbulk_ops = {
 	.destroy = bbulk_destroy,
 	.set = bbulk_set,
 	.unset = bbulk_unset,
-	.prepare = NULL,
+	.prepare = bbulk_prepare,
 	.draw = bbulk_draw,
 	.render = bbulk_render,
 	.abort = NULL,
+	.move_rows = bbulk_move_rows,
 };
@@ -34,6 +34,27 @@
  * texture sizes so we need to use multiple atlases. As there is no way to pass
  * a varying amount of textures to a shader, we need to render the screen for
  * each atlas we have.
+ * New glyphs are not uploaded immediately. Instead, they are copied into a
+ * CPU-side staging buffer of their atlas and all dirty atlases are flushed with
+ * a single row-spanning upload right before rendering.
+ * If the atlases exceed the glyph cache budget, the least-recently-used atlas
+ * that is not drawn in the current frame is recycled instead of allocating a
+ * new one. All glyphs it contained are dropped and rendered again on demand.
+ *
+ * The "gltex-sdf" variant stores signed distance fields instead of coverage.
+ * Glyphs are rasterized once with reference fonts of SDF_REF_HEIGHT pixels and
+ * the fragment shader thresholds the interpolated distance at any cell size.
+ * Changing the font size only changes the vertex positions and the smoothing
+ * uniform, so zooming neither rasterizes nor uploads any glyph.
+ *
+ * The "gltex-grid" variant does not emit any per-cell geometry. It keeps all
+ * glyphs in a single atlas with many slot rows and stores the console in a
+ * grid texture with the glyph slot and colors of each cell. The screen is drawn
+ * as one quad and the fragment shader looks up the cell and its glyph for each
+ * pixel. The grid texture is kept across frames so only the cells that were
+ * drawn are uploaded. As the grid references glyphs of earlier frames, the
+ * atlas is never recycled partially. Instead, once it might not hold another
+ * full screen, all glyphs are dropped and the next frame is redrawn completely.
  */
 
 #define GL_GLEXT_PROTOTYPES
@@ -42,19 +63,28 @@
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
 #include <limits.h>
+#include <math.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 #include "shl_dlist.h"
 #include "shl_gl.h"
-#include "shl_hashtable.h"
 #include "shl_log.h"
+#include "shl_lru.h"
+#include "shl_u32map.h"
 #include "shl_misc.h"
 #include "text.h"
 #include "uterm_video.h"
 
 #define LOG_SUBSYSTEM "text_gltex"
 
+/* height of the reference fonts and distance range of SDF atlases in pixels */
+#define SDF_REF_HEIGHT 48
+#define SDF_SPREAD 6
+
+/* the grid texture stores glyph slots with 16 bits */
+#define GRID_MAX_SLOTS 65536
+
 /* thanks khronos for breaking backwards compatibility.. */
 #if !defined(GL_UNPACK_ROW_LENGTH) && defined(GL_UNPACK_ROW_LENGTH_EXT)
 #  define GL_UNPACK_ROW_LENGTH GL_UNPACK_ROW_LENGTH_EXT
@@ -62,13 +92,20 @@
 
 struct atlas {
 	struct shl_dlist list;
+	struct shl_lru_entry lru;
+	struct shl_dlist glyphs;
 
 	GLuint tex;
 	unsigned int height;
 	unsigned int width;
 	unsigned int count;
+	unsigned int stride;
 	unsigned int fill;
 
+	uint8_t *stage;
+	unsigned int dirty_start;
+	unsigned int dirty_end;
+
 	unsigned int cache_size;
 	unsigned int cache_num;
 	GLfloat *cache_pos;
@@ -81,32 +118,64 @@ struct atlas {
 };
 
 struct glyph {
-	const struct kmscon_glyph *glyph;
+	struct shl_dlist list;
+	uint32_t id;
+	bool bold;
+	unsigned int width;
 	struct atlas *atlas;
 	unsigned int texoff;
 };
 
-#define GLYPH_WIDTH(gly) ((gly)->glyph->buf.width)
-#define GLYPH_HEIGHT(gly) ((gly)->glyph->buf.height)
-#define GLYPH_STRIDE(gly) ((gly)->glyph->buf.stride)
-#define GLYPH_DATA(gly) ((gly)->glyph->buf.data)
+SHL_U32MAP_DEFINE(glyph_map, struct glyph)
 
 struct gltex {
-	struct shl_hashtable *glyphs;
-	struct shl_hashtable *bold_glyphs;
+	struct glyph_map glyphs;
+	struct glyph_map bold_glyphs;
+	struct glyph **fast;
+	struct glyph **bold_fast;
 	unsigned int max_tex_size;
 	bool supports_rowlen;
 
 	struct shl_dlist atlases;
+	struct shl_lru lru;
+	unsigned long epoch;
+	unsigned long glyph_num;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
 
 	GLfloat advance_x;
 	GLfloat advance_y;
 
+	/* size of a cell in the atlases; the font size unless in SDF mode */
+	unsigned int cell_width;
+	unsigned int cell_height;
+
+	bool sdf;
+	struct kmscon_font *sdf_font;
+	struct kmscon_font *sdf_bold_font;
+	int16_t *sdf_grid;
+	GLfloat sdf_smooth;
+
+	bool grid;
+	GLuint grid_tex;
+	uint8_t *grid_cells;
+	unsigned int grid_x1;
+	unsigned int grid_y1;
+	unsigned int grid_x2;
+	unsigned int grid_y2;
+
 	struct gl_shader *shader;
 	GLuint uni_proj;
 	GLuint uni_atlas;
 	GLuint uni_advance_htex;
 	GLuint uni_advance_vtex;
+	GLuint uni_sdf_smooth;
+	GLuint uni_grid;
+	GLuint uni_cell_size;
+	GLuint uni_grid_size;
+	GLuint uni_atlas_size;
+	GLuint uni_atlas_stride;
 
 	unsigned int sw;
 	unsigned int sh;
@@ -122,11 +191,40 @@ static int gltex_init(struct kmscon_text *txt)
 	gt = malloc(sizeof(*gt));
 	if (!gt)
 		return -ENOMEM;
+	memset(gt, 0, sizeof(*gt));
 
 	txt->data = gt;
 	return 0;
 }
 
+static int gltex_sdf_init(struct kmscon_text *txt)
+{
+	struct gltex *gt;
+	int ret;
+
+	ret = gltex_init(txt);
+	if (ret)
+		return ret;
+
+	gt = txt->data;
+	gt->sdf = true;
+	return 0;
+}
+
+static int gltex_grid_init(struct kmscon_text *txt)
+{
+	struct gltex *gt;
+	int ret;
+
+	ret = gltex_init(txt);
+	if (ret)
+		return ret;
+
+	gt = txt->data;
+	gt->grid = true;
+	return 0;
+}
+
 static void gltex_destroy(struct kmscon_text *txt)
 {
 	struct gltex *gt = txt->data;
@@ -134,17 +232,116 @@ static void gltex_destroy(struct kmscon_text *txt)
 	free(gt);
 }
 
-static void free_glyph(void *data)
+static void free_glyph(struct glyph *glyph)
 {
-	struct glyph *glyph = data;
-
 	free(glyph);
 }
 
+/* Load the fonts SDF glyphs are rasterized with. They use the backend of the
+ * current font at the reference size. Bold glyphs fall back to the regular
+ * reference font if the backend has no bold variant. */
+static int sdf_load_fonts(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct kmscon_font_attr attr;
+	int ret;
+
+	memcpy(&attr, &txt->font->attr, sizeof(attr));
+	attr.bold = false;
+	attr.points = 0;
+	attr.width = 0;
+	attr.height = SDF_REF_HEIGHT;
+	kmscon_font_attr_normalize(&attr);
+
+	ret = kmscon_font_find(&gt->sdf_font, &attr, txt->font->ops->name);
+	if (ret) {
+		log_error("cannot load SDF reference font: %d", ret);
+		return ret;
+	}
+
+	if (txt->bold_font != txt->font) {
+		attr.bold = true;
+		ret = kmscon_font_find(&gt->sdf_bold_font, &attr,
+				       txt->font->ops->name);
+		if (!ret && (gt->sdf_bold_font->attr.width !=
+			     gt->sdf_font->attr.width ||
+			     gt->sdf_bold_font->attr.height !=
+			     gt->sdf_font->attr.height)) {
+			kmscon_font_unref(gt->sdf_bold_font);
+			ret = -EINVAL;
+		}
+		if (!ret)
+			return 0;
+
+		log_warning("cannot load SDF reference bold font: %d", ret);
+	}
+
+	gt->sdf_bold_font = gt->sdf_font;
+	kmscon_font_ref(gt->sdf_bold_font);
+	return 0;
+}
+
+static void sdf_unload_fonts(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+
+	kmscon_font_unref(gt->sdf_bold_font);
+	kmscon_font_unref(gt->sdf_font);
+	gt->sdf_bold_font = NULL;
+	gt->sdf_font = NULL;
+}
+
+/* The shader blends over one screen pixel around the outline. The distance
+ * fields store SDF_SPREAD reference pixels in each direction of the outline. */
+static void sdf_update_smooth(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	GLfloat scale;
+
+	if (!gt->sdf)
+		return;
+
+	scale = (GLfloat)gt->cell_height / FONT_HEIGHT(txt);
+	gt->sdf_smooth = 0.5 * scale / (2.0 * SDF_SPREAD);
+	if (gt->sdf_smooth < 1.0 / 255.0)
+		gt->sdf_smooth = 1.0 / 255.0;
+	if (gt->sdf_smooth > 0.5)
+		gt->sdf_smooth = 0.5;
+}
+
+static void free_atlases(struct kmscon_text *txt, bool gl)
+{
+	struct gltex *gt = txt->data;
+	struct shl_dlist *iter;
+	struct atlas *atlas;
+
+	while (!shl_dlist_empty(&gt->atlases)) {
+		iter = gt->atlases.next;
+		shl_dlist_unlink(iter);
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+
+		free(atlas->cache_pos);
+		free(atlas->cache_texpos);
+		free(atlas->cache_fgcol);
+		free(atlas->cache_bgcol);
+		free(atlas->stage);
+
+		if (gl)
+			gl_tex_free(&atlas->tex, 1);
+		free(atlas);
+	}
+}
+
 extern const char _binary_src_text_gltex_atlas_vert_bin_start[];
 extern const char _binary_src_text_gltex_atlas_vert_bin_end[];
 extern const char _binary_src_text_gltex_atlas_frag_bin_start[];
 extern const char _binary_src_text_gltex_atlas_frag_bin_end[];
+extern const char _binary_src_text_gltex_grid_vert_bin_start[];
+extern const char _binary_src_text_gltex_grid_vert_bin_end[];
+extern const char _binary_src_text_gltex_grid_frag_bin_start[];
+extern const char _binary_src_text_gltex_grid_frag_bin_end[];
+
+static int grid_set(struct kmscon_text *txt);
 
 static int gltex_set(struct kmscon_text *txt)
 {
@@ -153,56 +350,105 @@ static int gltex_set(struct kmscon_text *txt)
 	const char *vert, *frag;
 	static char *attr[] = { "position", "texture_position",
 				"fgcolor", "bgcolor" };
-	GLint s;
+	GLint s, range[2], precision = 0;
 	const char *ext;
 	struct uterm_mode *mode;
-	bool opengl;
+	bool opengl, sdf = gt->sdf, grid = gt->grid;
 
 	memset(gt, 0, sizeof(*gt));
+	gt->sdf = sdf;
+	gt->grid = grid;
 	shl_dlist_init(&gt->atlases);
+	shl_lru_init(&gt->lru, kmscon_font_get_cache_limit());
 
-	ret = shl_hashtable_new(&gt->glyphs, shl_direct_hash,
-				shl_direct_equal, NULL,
-				free_glyph);
-	if (ret)
-		return ret;
-
-	ret = shl_hashtable_new(&gt->bold_glyphs, shl_direct_hash,
-				shl_direct_equal, NULL,
-				free_glyph);
-	if (ret)
-		goto err_htable;
+	gt->fast = calloc(KMSCON_GLYPH_FAST_NUM, sizeof(*gt->fast));
+	gt->bold_fast = calloc(KMSCON_GLYPH_FAST_NUM, sizeof(*gt->bold_fast));
+	if (!gt->fast || !gt->bold_fast) {
+		ret = -ENOMEM;
+		goto err_fast;
+	}
 
 	ret = uterm_display_use(txt->disp, &opengl);
 	if (ret < 0 || !opengl) {
 		if (ret == -EOPNOTSUPP)
 			log_error("display doesn't support hardware-acceleration");
-		goto err_bold_htable;
+		goto err_fast;
+	}
+
+	/* the grid shader needs highp pixel positions, which are optional in
+	 * fragment shaders, so fall back to per-cell geometry without them */
+	if (gt->grid) {
+		glGetShaderPrecisionFormat(GL_FRAGMENT_SHADER, GL_HIGH_FLOAT,
+					   range, &precision);
+		if (!precision) {
+			log_warning("fragment shaders do not support highp, using per-cell geometry instead of the grid");
+			gt->grid = false;
+		}
 	}
 
-	vert = _binary_src_text_gltex_atlas_vert_bin_start;
-	vlen = _binary_src_text_gltex_atlas_vert_bin_end - vert;
-	frag = _binary_src_text_gltex_atlas_frag_bin_start;
-	flen = _binary_src_text_gltex_atlas_frag_bin_end - frag;
+	if (gt->grid) {
+		vert = _binary_src_text_gltex_grid_vert_bin_start;
+		vlen = _binary_src_text_gltex_grid_vert_bin_end - vert;
+		frag = _binary_src_text_gltex_grid_frag_bin_start;
+		flen = _binary_src_text_gltex_grid_frag_bin_end - frag;
+	} else {
+		vert = _binary_src_text_gltex_atlas_vert_bin_start;
+		vlen = _binary_src_text_gltex_atlas_vert_bin_end - vert;
+		frag = _binary_src_text_gltex_atlas_frag_bin_start;
+		flen = _binary_src_text_gltex_atlas_frag_bin_end - frag;
+	}
 	gl_clear_error();
 
-	ret = gl_shader_new(&gt->shader, vert, vlen, frag, flen, attr, 4,
-			    log_llog, NULL);
+	/* the grid shader uses the first two attributes only */
+	ret = gl_shader_new(&gt->shader, vert, vlen, frag, flen, attr,
+			    gt->grid ? 2 : 4, log_llog, NULL);
 	if (ret)
-		goto err_bold_htable;
+		goto err_fast;
 
-	gt->uni_proj = gl_shader_get_uniform(gt->shader, "projection");
 	gt->uni_atlas = gl_shader_get_uniform(gt->shader, "atlas");
-	gt->uni_advance_htex = gl_shader_get_uniform(gt->shader,
-						     "advance_htex");
-	gt->uni_advance_vtex = gl_shader_get_uniform(gt->shader,
-						     "advance_vtex");
+	if (gt->grid) {
+		gt->uni_grid = gl_shader_get_uniform(gt->shader, "grid");
+		gt->uni_cell_size = gl_shader_get_uniform(gt->shader,
+							  "cell_size");
+		gt->uni_grid_size = gl_shader_get_uniform(gt->shader,
+							  "grid_size");
+		gt->uni_atlas_size = gl_shader_get_uniform(gt->shader,
+							   "atlas_size");
+		gt->uni_atlas_stride = gl_shader_get_uniform(gt->shader,
+							     "atlas_stride");
+	} else {
+		gt->uni_proj = gl_shader_get_uniform(gt->shader, "projection");
+		gt->uni_advance_htex = gl_shader_get_uniform(gt->shader,
+							     "advance_htex");
+		gt->uni_advance_vtex = gl_shader_get_uniform(gt->shader,
+							     "advance_vtex");
+		gt->uni_sdf_smooth = gl_shader_get_uniform(gt->shader,
+							   "sdf_smooth");
+	}
 
 	if (gl_has_error(gt->shader)) {
 		log_warning("cannot create shader");
 		goto err_shader;
 	}
 
+	if (gt->sdf) {
+		ret = sdf_load_fonts(txt);
+		if (ret)
+			goto err_shader;
+
+		gt->cell_width = gt->sdf_font->attr.width;
+		gt->cell_height = gt->sdf_font->attr.height;
+		gt->sdf_grid = malloc(sizeof(*gt->sdf_grid) * 4 * 2 *
+				      gt->cell_width * gt->cell_height);
+		if (!gt->sdf_grid) {
+			ret = -ENOMEM;
+			goto err_sdf;
+		}
+	} else {
+		gt->cell_width = FONT_WIDTH(txt);
+		gt->cell_height = FONT_HEIGHT(txt);
+	}
+
 	mode = uterm_display_get_current(txt->disp);
 	gt->sw = uterm_mode_get_width(mode);
 	gt->sh = uterm_mode_get_height(mode);
@@ -210,13 +456,17 @@ static int gltex_set(struct kmscon_text *txt)
 	txt->cols = gt->sw / FONT_WIDTH(txt);
 	txt->rows = gt->sh / FONT_HEIGHT(txt);
 
+	/* the single atlas of the grid mode must hold a whole screen */
 	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &s);
 	if (s <= 0)
 		s = 64;
-	else if (s > 2048)
+	else if (s > 2048 && !gt->grid)
 		s = 2048;
+	else if (s > 4096)
+		s = 4096;
 	gt->max_tex_size = s;
 
+	sdf_update_smooth(txt);
 	gl_clear_error();
 
 	ext = (const char*)glGetString(GL_EXTENSIONS);
@@ -226,14 +476,23 @@ static int gltex_set(struct kmscon_text *txt)
 		log_warning("your GL implementation does not support GL_EXT_unpack_subimage, glyph-rendering may be slower than usual");
 	}
 
+	if (gt->grid) {
+		ret = grid_set(txt);
+		if (ret)
+			goto err_grid;
+	}
+
 	return 0;
 
+err_grid:
+	free_atlases(txt, true);
+err_sdf:
+	sdf_unload_fonts(txt);
 err_shader:
 	gl_shader_unref(gt->shader);
-err_bold_htable:
-	shl_hashtable_free(gt->bold_glyphs);
-err_htable:
-	shl_hashtable_free(gt->glyphs);
+err_fast:
+	free(gt->bold_fast);
+	free(gt->fast);
 	return ret;
 }
 
@@ -241,8 +500,6 @@ static void gltex_unset(struct kmscon_text *txt)
 {
 	struct gltex *gt = txt->data;
 	int ret;
-	struct shl_dlist *iter;
-	struct atlas *atlas;
 	bool gl = true;
 
 	ret = uterm_display_use(txt->disp, NULL);
@@ -251,46 +508,155 @@ static void gltex_unset(struct kmscon_text *txt)
 		log_warning("cannot activate OpenGL-CTX during destruction");
 	}
 
-	shl_hashtable_free(gt->bold_glyphs);
-	shl_hashtable_free(gt->glyphs);
-
-	while (!shl_dlist_empty(&gt->atlases)) {
-		iter = gt->atlases.next;
-		shl_dlist_unlink(iter);
-		atlas = shl_dlist_entry(iter, struct atlas, list);
-
-		free(atlas->cache_pos);
-		free(atlas->cache_texpos);
-		free(atlas->cache_fgcol);
-		free(atlas->cache_bgcol);
+	log_debug("glyph cache: %lu glyphs, %zu bytes, %lu evictions",
+		  gt->glyph_num, gt->lru.size, gt->evictions);
 
-		if (gl)
-			gl_tex_free(&atlas->tex, 1);
-		free(atlas);
-	}
+	free(gt->bold_fast);
+	free(gt->fast);
+	glyph_map_clear(&gt->bold_glyphs, free_glyph);
+	glyph_map_clear(&gt->glyphs, free_glyph);
+	free(gt->sdf_grid);
+	sdf_unload_fonts(txt);
+	free(gt->grid_cells);
+	free_atlases(txt, gl);
 
 	if (gl) {
+		if (gt->grid)
+			gl_tex_free(&gt->grid_tex, 1);
 		gl_shader_unref(gt->shader);
 
 		gl_clear_error();
 	}
 }
 
+static void drop_glyphs(struct kmscon_text *txt, struct atlas *atlas)
+{
+	struct gltex *gt = txt->data;
+	struct glyph *glyph;
+
+	while (!shl_dlist_empty(&atlas->glyphs)) {
+		glyph = shl_dlist_first(&atlas->glyphs, struct glyph, list);
+		shl_dlist_unlink(&glyph->list);
+		--gt->glyph_num;
+		++gt->evictions;
+		if (glyph->id < KMSCON_GLYPH_FAST_NUM) {
+			if (glyph->bold)
+				gt->bold_fast[glyph->id] = NULL;
+			else
+				gt->fast[glyph->id] = NULL;
+		}
+		glyph_map_remove(glyph->bold ? &gt->bold_glyphs : &gt->glyphs,
+				 glyph->id);
+		free_glyph(glyph);
+	}
+
+	atlas->fill = 0;
+	atlas->dirty_start = 0;
+	atlas->dirty_end = 0;
+}
+
+/* Drop all glyphs of @atlas and make it the atlas new glyphs are added to. The
+ * atlas must not be drawn in the current frame. */
+static void recycle_atlas(struct kmscon_text *txt, struct atlas *atlas)
+{
+	struct gltex *gt = txt->data;
+
+	drop_glyphs(txt, atlas);
+	shl_lru_touch(&gt->lru, &atlas->lru, gt->epoch);
+
+	shl_dlist_unlink(&atlas->list);
+	shl_dlist_link(&gt->atlases, &atlas->list);
+}
+
+/* Atlases are kept and refilled on demand, only their glyphs are dropped. */
+static void gltex_flush(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct shl_dlist *iter;
+
+	shl_dlist_for_each(iter, &gt->atlases)
+		drop_glyphs(txt, shl_dlist_entry(iter, struct atlas, list));
+}
+
+/* Glyph slots are laid out row by row with @stride slots per row. Only the
+ * atlas of the grid mode has more than one row. */
+static void slot_pos(struct kmscon_text *txt, const struct atlas *atlas,
+		     unsigned int slot, unsigned int *x, unsigned int *y)
+{
+	struct gltex *gt = txt->data;
+
+	*x = gt->cell_width * (slot % atlas->stride);
+	*y = gt->cell_height * (slot / atlas->stride);
+}
+
+/* returns the first slot with room for @num slots in one row */
+static unsigned int next_slot(const struct atlas *atlas, unsigned int num)
+{
+	unsigned int col = atlas->fill % atlas->stride;
+
+	if (col + num > atlas->stride)
+		return atlas->fill - col + atlas->stride;
+	return atlas->fill;
+}
+
+/* (re)allocate the vertex caches of @atlas for @nsize cells */
+static int alloc_cache(struct atlas *atlas, unsigned int nsize)
+{
+	GLfloat *pos, *texpos, *fgcol, *bgcol;
+
+	pos = malloc(sizeof(GLfloat) * nsize * 2 * 6);
+	texpos = malloc(sizeof(GLfloat) * nsize * 2 * 6);
+	fgcol = malloc(sizeof(GLfloat) * nsize * 3 * 6);
+	bgcol = malloc(sizeof(GLfloat) * nsize * 3 * 6);
+	if (!pos || !texpos || !fgcol || !bgcol) {
+		free(bgcol);
+		free(fgcol);
+		free(texpos);
+		free(pos);
+		return -ENOMEM;
+	}
+
+	free(atlas->cache_pos);
+	free(atlas->cache_texpos);
+	free(atlas->cache_fgcol);
+	free(atlas->cache_bgcol);
+	atlas->cache_pos = pos;
+	atlas->cache_texpos = texpos;
+	atlas->cache_fgcol = fgcol;
+	atlas->cache_bgcol = bgcol;
+	atlas->cache_size = nsize;
+	atlas->cache_num = 0;
+	return 0;
+}
+
 /* returns an atlas with at least 1 free glyph position; NULL on error */
 static struct atlas *get_atlas(struct kmscon_text *txt, unsigned int num)
 {
 	struct gltex *gt = txt->data;
 	struct atlas *atlas;
-	size_t newsize;
-	unsigned int width, height, nsize;
+	size_t newsize, rows = 1;
+	unsigned int width, height;
 	GLenum err;
 
 	/* check whether the last added atlas has still room for one glyph */
 	if (!shl_dlist_empty(&gt->atlases)) {
 		atlas = shl_dlist_entry(gt->atlases.next, struct atlas,
 					   list);
-		if (atlas->fill + num <= atlas->count)
+		if (next_slot(atlas, num) + num <= atlas->count)
+			return atlas;
+		/* the grid mode refills its only atlas in gltex_prepare() */
+		if (gt->grid)
+			return NULL;
+	}
+
+	/* if the budget is used up, recycle the least-recently-used atlas */
+	if (gt->lru.limit && gt->lru.size >= gt->lru.limit &&
+	    !shl_dlist_empty(&gt->lru.list)) {
+		atlas = shl_dlist_last(&gt->lru.list, struct atlas, lru.list);
+		if (atlas->lru.epoch < gt->epoch && num <= atlas->count) {
+			recycle_atlas(txt, atlas);
 			return atlas;
+		}
 	}
 
 	/* all atlases are full so we have to create a new atlas */
@@ -309,16 +675,28 @@ static struct atlas *get_atlas(struct kmscon_text *txt, unsigned int num)
 		goto err_free;
 	}
 
-	newsize = gt->max_tex_size / FONT_WIDTH(txt);
+	newsize = gt->max_tex_size / gt->cell_width;
 	if (newsize < 1)
 		newsize = 1;
 
+	/* The grid atlas gets enough slot rows for two screens so it is
+	 * refilled only after a full screen of new glyphs. */
+	if (gt->grid) {
+		rows = (txt->cols * txt->rows * 2 + newsize - 1) / newsize;
+		if (rows > gt->max_tex_size / gt->cell_height)
+			rows = gt->max_tex_size / gt->cell_height;
+		if (rows > GRID_MAX_SLOTS / newsize)
+			rows = GRID_MAX_SLOTS / newsize;
+		if (rows < 1)
+			rows = 1;
+	}
+
 	/* OpenGL texture sizes are heavily restricted so we need to find a
 	 * valid texture size that is big enough to hold as many glyphs as
 	 * possible but at least 1 */
 try_next:
-	width = shl_next_pow2(FONT_WIDTH(txt) * newsize);
-	height = shl_next_pow2(FONT_HEIGHT(txt));
+	width = shl_next_pow2(gt->cell_width * newsize);
+	height = shl_next_pow2(gt->cell_height * rows);
 
 	gl_clear_error();
 
@@ -328,6 +706,10 @@ try_next:
 
 	err = glGetError();
 	if (err != GL_NO_ERROR) {
+		if (rows > 1) {
+			rows /= 2;
+			goto try_next;
+		}
 		if (newsize > 1) {
 			--newsize;
 			goto try_next;
@@ -338,41 +720,35 @@ try_next:
 		goto err_tex;
 	}
 
-	log_debug("new atlas of size %ux%u for %zu", width, height, newsize);
-
-	nsize = txt->cols * txt->rows;
+	log_debug("new atlas of size %ux%u for %zu", width, height,
+		  newsize * rows);
 
-	atlas->cache_pos = malloc(sizeof(GLfloat) * nsize * 2 * 6);
-	if (!atlas->cache_pos)
-		goto err_mem;
-
-	atlas->cache_texpos = malloc(sizeof(GLfloat) * nsize * 2 * 6);
-	if (!atlas->cache_texpos)
-		goto err_mem;
-
-	atlas->cache_fgcol = malloc(sizeof(GLfloat) * nsize * 3 * 6);
-	if (!atlas->cache_fgcol)
-		goto err_mem;
+	/* The staging buffer mirrors the whole texture so we can always upload
+	 * full rows if GL_UNPACK_ROW_LENGTH is not supported. */
+	atlas->stage = malloc(width * height);
+	if (!atlas->stage)
+		goto err_tex;
+	memset(atlas->stage, 0, width * height);
 
-	atlas->cache_bgcol = malloc(sizeof(GLfloat) * nsize * 3 * 6);
-	if (!atlas->cache_bgcol)
+	/* the grid mode does not need any vertices */
+	if (!gt->grid && alloc_cache(atlas, txt->cols * txt->rows))
 		goto err_mem;
 
-	atlas->cache_size = nsize;
-	atlas->count = newsize;
+	atlas->count = newsize * rows;
+	atlas->stride = newsize;
 	atlas->width = width;
 	atlas->height = height;
-	atlas->advance_htex = 1.0 / atlas->width * FONT_WIDTH(txt);
-	atlas->advance_vtex = 1.0 / atlas->height * FONT_HEIGHT(txt);
+	atlas->advance_htex = 1.0 / atlas->width * gt->cell_width;
+	atlas->advance_vtex = 1.0 / atlas->height * gt->cell_height;
 
+	shl_dlist_init(&atlas->glyphs);
 	shl_dlist_link(&gt->atlases, &atlas->list);
+	/* texture plus staging buffer */
+	shl_lru_add(&gt->lru, &atlas->lru, width * height * 2, gt->epoch);
 	return atlas;
 
 err_mem:
-	free(atlas->cache_pos);
-	free(atlas->cache_texpos);
-	free(atlas->cache_fgcol);
-	free(atlas->cache_bgcol);
+	free(atlas->stage);
 err_tex:
 	gl_tex_free(&atlas->tex, 1);
 err_free:
@@ -380,30 +756,210 @@ err_free:
 	return NULL;
 }
 
+/* copy glyph data into the staging buffer of its atlas at slot @slot */
+static void stage_glyph(struct kmscon_text *txt, struct atlas *atlas,
+			const struct kmscon_glyph *glyph, unsigned int slot)
+{
+	struct gltex *gt = txt->data;
+	unsigned int i, x, y, width, height;
+	uint8_t *dst, *src;
+
+	slot_pos(txt, atlas, slot, &x, &y);
+	if (x >= atlas->width || y >= atlas->height)
+		return;
+
+	width = glyph->buf.width;
+	if (width > atlas->width - x)
+		width = atlas->width - x;
+	height = glyph->buf.height;
+	if (height > gt->cell_height)
+		height = gt->cell_height;
+	if (height > atlas->height - y)
+		height = atlas->height - y;
+
+	src = glyph->buf.data;
+	dst = &atlas->stage[y * atlas->width + x];
+	for (i = 0; i < height; ++i) {
+		if (glyph->buf.format == UTERM_FORMAT_MONO)
+			uterm_video_mono_to_grey(dst, src, width);
+		else
+			memcpy(dst, src, width);
+		dst += atlas->width;
+		src += glyph->buf.stride;
+	}
+}
+
+/*
+ * Signed Distance Fields
+ * The distance of each texel to the nearest texel of the other side of the
+ * outline is computed with two passes of the 8-point sequential Euclidean
+ * distance transform over a grid of offsets to the nearest set texel. One grid
+ * tracks the nearest inside texel, the other the nearest outside texel. The
+ * area around the cell counts as outside.
+ */
+
+#define SDF_FAR 0x3fff
+
+static int sdf_dist2(const int16_t *p)
+{
+	return p[0] * p[0] + p[1] * p[1];
+}
+
+static void sdf_compare(int16_t *grid, int w, int h, int x, int y,
+			int ox, int oy, bool outside)
+{
+	int16_t *p = &grid[(y * w + x) * 2], o[2];
+	int nx = x + ox, ny = y + oy;
+
+	if (nx < 0 || ny < 0 || nx >= w || ny >= h) {
+		if (!outside)
+			return;
+		o[0] = 0;
+		o[1] = 0;
+	} else {
+		o[0] = grid[(ny * w + nx) * 2];
+		o[1] = grid[(ny * w + nx) * 2 + 1];
+		if (o[0] == SDF_FAR)
+			return;
+	}
+
+	o[0] += ox;
+	o[1] += oy;
+	if (sdf_dist2(o) < sdf_dist2(p)) {
+		p[0] = o[0];
+		p[1] = o[1];
+	}
+}
+
+static void sdf_transform(int16_t *grid, int w, int h, bool outside)
+{
+	int x, y;
+
+	for (y = 0; y < h; ++y) {
+		for (x = 0; x < w; ++x) {
+			sdf_compare(grid, w, h, x, y, -1, 0, outside);
+			sdf_compare(grid, w, h, x, y, 0, -1, outside);
+			sdf_compare(grid, w, h, x, y, -1, -1, outside);
+			sdf_compare(grid, w, h, x, y, 1, -1, outside);
+		}
+		for (x = w - 1; x >= 0; --x)
+			sdf_compare(grid, w, h, x, y, 1, 0, outside);
+	}
+
+	for (y = h - 1; y >= 0; --y) {
+		for (x = w - 1; x >= 0; --x) {
+			sdf_compare(grid, w, h, x, y, 1, 0, outside);
+			sdf_compare(grid, w, h, x, y, 0, 1, outside);
+			sdf_compare(grid, w, h, x, y, -1, 1, outside);
+			sdf_compare(grid, w, h, x, y, 1, 1, outside);
+		}
+		for (x = 0; x < w; ++x)
+			sdf_compare(grid, w, h, x, y, -1, 0, outside);
+	}
+}
+
+static bool sdf_inside(const struct kmscon_glyph *glyph, unsigned int x,
+		       unsigned int y)
+{
+	const uint8_t *row;
+
+	if (x >= glyph->buf.width || y >= glyph->buf.height)
+		return false;
+
+	row = &glyph->buf.data[y * glyph->buf.stride];
+	if (glyph->buf.format == UTERM_FORMAT_MONO)
+		return row[x / 8] & (0x80 >> (x % 8));
+	return row[x] >= 0x80;
+}
+
+/* store the distance field of @glyph in the staging buffer at slot @slot */
+static void stage_sdf_glyph(struct kmscon_text *txt, struct atlas *atlas,
+			    const struct kmscon_glyph *glyph, unsigned int slot)
+{
+	struct gltex *gt = txt->data;
+	int16_t *in, *out;
+	uint8_t *dst;
+	unsigned int i, j, k, x, y, w, h;
+	bool inside;
+	float d, v;
+
+	slot_pos(txt, atlas, slot, &x, &y);
+	w = gt->cell_width * (glyph->width > 1 ? 2 : 1);
+	h = gt->cell_height;
+	if (x >= atlas->width || y >= atlas->height)
+		return;
+	if (w > atlas->width - x)
+		w = atlas->width - x;
+	if (h > atlas->height - y)
+		h = atlas->height - y;
+
+	in = gt->sdf_grid;
+	out = &gt->sdf_grid[w * h * 2];
+	for (j = 0; j < h; ++j) {
+		for (i = 0; i < w; ++i) {
+			inside = sdf_inside(glyph, i, j);
+			in[(j * w + i) * 2] = inside ? 0 : SDF_FAR;
+			in[(j * w + i) * 2 + 1] = inside ? 0 : SDF_FAR;
+			out[(j * w + i) * 2] = inside ? SDF_FAR : 0;
+			out[(j * w + i) * 2 + 1] = inside ? SDF_FAR : 0;
+		}
+	}
+
+	sdf_transform(in, w, h, false);
+	sdf_transform(out, w, h, true);
+
+	/* the outline lies half a texel beyond the outermost texels */
+	dst = &atlas->stage[y * atlas->width + x];
+	for (j = 0; j < h; ++j) {
+		for (i = 0; i < w; ++i) {
+			k = (j * w + i) * 2;
+			if (sdf_inside(glyph, i, j))
+				d = sqrtf(sdf_dist2(&out[k])) - 0.5;
+			else
+				d = 0.5 - sqrtf(sdf_dist2(&in[k]));
+
+			v = 0.5 + d / (2.0 * SDF_SPREAD);
+			if (v < 0.0)
+				v = 0.0;
+			else if (v > 1.0)
+				v = 1.0;
+			dst[i] = v * 255.0 + 0.5;
+		}
+		dst += atlas->width;
+	}
+}
+
 static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 		      uint32_t id, const uint32_t *ch, size_t len, bool bold)
 {
 	struct gltex *gt = txt->data;
 	struct atlas *atlas;
-	struct glyph *glyph;
-	bool res;
-	int ret, i;
-	GLenum err;
-	uint8_t *packed_data, *dst, *src;
-	struct shl_hashtable *gtable;
+	struct glyph *glyph, **fast;
+	const struct kmscon_glyph *kglyph;
+	int ret;
+	struct glyph_map *gtable;
 	struct kmscon_font *font;
+	unsigned int slot;
 
 	if (bold) {
-		gtable = gt->bold_glyphs;
-		font = txt->bold_font;
+		gtable = &gt->bold_glyphs;
+		fast = gt->bold_fast;
+		font = gt->sdf ? gt->sdf_bold_font : txt->bold_font;
 	} else {
-		gtable = gt->glyphs;
-		font = txt->font;
+		gtable = &gt->glyphs;
+		fast = gt->fast;
+		font = gt->sdf ? gt->sdf_font : txt->font;
+	}
+
+	if (id < KMSCON_GLYPH_FAST_NUM && fast[id]) {
+		++gt->hits;
+		*out = fast[id];
+		return 0;
 	}
 
-	res = shl_hashtable_find(gtable, (void**)&glyph,
-				 (void*)(unsigned long)id);
-	if (res) {
+	glyph = glyph_map_find(gtable, id);
+	if (glyph) {
+		++gt->hits;
 		*out = glyph;
 		return 0;
 	}
@@ -412,113 +968,301 @@ static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 	if (!glyph)
 		return -ENOMEM;
 	memset(glyph, 0, sizeof(*glyph));
+	glyph->id = id;
+	glyph->bold = bold;
 
 	if (!len)
-		ret = kmscon_font_render_empty(font, &glyph->glyph);
+		ret = kmscon_font_render_empty(font, &kglyph);
 	else
-		ret = kmscon_font_render(font, id, ch, len, &glyph->glyph);
+		ret = kmscon_font_render(font, id, ch, len, &kglyph);
 
 	if (ret) {
-		ret = kmscon_font_render_inval(font, &glyph->glyph);
+		ret = kmscon_font_render_inval(font, &kglyph);
 		if (ret)
 			goto err_free;
 	}
 
-	atlas = get_atlas(txt, glyph->glyph->width);
+	/* the font glyph is only needed until it is staged */
+	glyph->width = kglyph->width;
+	atlas = get_atlas(txt, glyph->width);
 	if (!atlas) {
 		ret = -EFAULT;
 		goto err_free;
 	}
 
-	/* Funnily, not all OpenGLESv2 implementations support specifying the
-	 * stride of a texture. Therefore, we then need to create a
-	 * temporary image with a stride equal to the image width for loading
-	 * the texture. This may slow down loading new glyphs but doesn't affect
-	 * overall rendering performance. But driver developers should really
-	 * add this! */
+	slot = next_slot(atlas, glyph->width);
+	if (gt->sdf)
+		stage_sdf_glyph(txt, atlas, kglyph, slot);
+	else
+		stage_glyph(txt, atlas, kglyph, slot);
 
-	gl_clear_error();
+	glyph->atlas = atlas;
+	glyph->texoff = slot;
 
-	glBindTexture(GL_TEXTURE_2D, atlas->tex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	if (!gt->supports_rowlen) {
-		if (GLYPH_STRIDE(glyph) == GLYPH_WIDTH(glyph)) {
-			glTexSubImage2D(GL_TEXTURE_2D, 0,
-					FONT_WIDTH(txt) * atlas->fill, 0,
-					GLYPH_WIDTH(glyph),
-					GLYPH_HEIGHT(glyph),
-					GL_ALPHA, GL_UNSIGNED_BYTE,
-					GLYPH_DATA(glyph));
-		} else {
-			packed_data = malloc(GLYPH_WIDTH(glyph) * GLYPH_HEIGHT(glyph));
-			if (!packed_data) {
-				log_error("cannot allocate memory for glyph storage");
-				ret = -ENOMEM;
-				goto err_free;
-			}
-
-			src = GLYPH_DATA(glyph);
-			dst = packed_data;
-			for (i = 0; i < GLYPH_HEIGHT(glyph); ++i) {
-				memcpy(dst, src, GLYPH_WIDTH(glyph));
-				dst += GLYPH_WIDTH(glyph);
-				src += GLYPH_STRIDE(glyph);
-			}
-
-			glTexSubImage2D(GL_TEXTURE_2D, 0,
-					FONT_WIDTH(txt) * atlas->fill, 0,
-					GLYPH_WIDTH(glyph),
-					GLYPH_HEIGHT(glyph),
-					GL_ALPHA, GL_UNSIGNED_BYTE,
-					packed_data);
-			free(packed_data);
-		}
-	} else {
-		glPixelStorei(GL_UNPACK_ROW_LENGTH, GLYPH_STRIDE(glyph));
-		glTexSubImage2D(GL_TEXTURE_2D, 0,
-				FONT_WIDTH(txt) * atlas->fill, 0,
-				GLYPH_WIDTH(glyph),
-				GLYPH_HEIGHT(glyph),
-				GL_ALPHA, GL_UNSIGNED_BYTE,
-				GLYPH_DATA(glyph));
-		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	ret = glyph_map_insert(gtable, id, glyph);
+	if (ret)
+		goto err_free;
+
+	shl_dlist_link(&atlas->glyphs, &glyph->list);
+	if (id < KMSCON_GLYPH_FAST_NUM)
+		fast[id] = glyph;
+	++gt->glyph_num;
+	++gt->misses;
+
+	if (atlas->dirty_start == atlas->dirty_end)
+		atlas->dirty_start = slot;
+	atlas->fill = slot + glyph->width;
+	atlas->dirty_end = atlas->fill;
+
+	*out = glyph;
+	return 0;
+
+err_free:
+	free(glyph);
+	return ret;
+}
+
+/*
+ * Grid Mode
+ * Each cell is stored as two RGBA texels in the grid texture. The first one
+ * holds the foreground color and the high byte of the glyph slot, the second
+ * one the background color and the low byte. Cells of the previous frames stay
+ * in gt->grid_cells and mirror the grid texture. Cells that are drawn with the
+ * same contents again are skipped, so only the bounding box of the cells that
+ * actually changed is uploaded, even if the display provides no buffer age and
+ * every cell is drawn in each frame.
+ */
+
+/* free slots needed for a full screen; a wide glyph may leave the last slot of
+ * each row unused */
+static unsigned int grid_reserve(struct kmscon_text *txt,
+				 const struct atlas *atlas)
+{
+	return txt->cols * txt->rows + atlas->count / atlas->stride;
+}
+
+static int grid_set(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct atlas *atlas;
+	GLenum err;
+	int ret;
+
+	atlas = get_atlas(txt, 1);
+	if (!atlas)
+		return -EFAULT;
+
+	if (atlas->count < grid_reserve(txt, atlas)) {
+		log_error("glyph atlas with %u slots cannot hold %ux%u cells",
+			  atlas->count, txt->cols, txt->rows);
+		return -EOPNOTSUPP;
 	}
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-	/* Check for GL-errors
-	 * As OpenGL is a state-machine, we cannot really tell which call failed
-	 * without adding a glGetError() after each call. This is totally
-	 * overkill so let us at least catch the error afterwards.
-	 * We also add a hint to disable OpenGL if this does not work. This
-	 * should _always_ work but OpenGL is kind of a black-box that isn't
-	 * verbose at all and many things can go wrong. */
+	gt->grid_cells = calloc(txt->cols * txt->rows, 8);
+	if (!gt->grid_cells)
+		return -ENOMEM;
+
+	gl_clear_error();
+
+	gl_tex_new(&gt->grid_tex, 1);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, txt->cols * 2, txt->rows,
+		     0, GL_RGBA, GL_UNSIGNED_BYTE, gt->grid_cells);
 
 	err = glGetError();
 	if (err != GL_NO_ERROR) {
 		gl_clear_error();
-		log_warning("cannot load glyph data into OpenGL texture (%d: %s); disable the GL-renderer if this does not work reliably",
-			    err, gl_err_to_str(err));
+		log_error("cannot create grid texture (%d: %s)",
+			  err, gl_err_to_str(err));
 		ret = -EFAULT;
-		goto err_free;
+		goto err_tex;
 	}
 
-	glyph->atlas = atlas;
-	glyph->texoff = atlas->fill;
+	gt->grid_x1 = txt->cols;
+	gt->grid_y1 = txt->rows;
+	gt->grid_x2 = 0;
+	gt->grid_y2 = 0;
 
-	ret = shl_hashtable_insert(gtable, (void*)(long)id, glyph);
-	if (ret)
-		goto err_free;
-
-	atlas->fill += glyph->glyph->width;
-
-	*out = glyph;
+	log_debug("grid of %ux%u cells with %u glyph slots",
+		  txt->cols, txt->rows, atlas->count);
 	return 0;
 
-err_free:
-	free(glyph);
+err_tex:
+	gl_tex_free(&gt->grid_tex, 1);
+	free(gt->grid_cells);
+	gt->grid_cells = NULL;
 	return ret;
 }
 
+/* Unchanged cells may reference any glyph of the atlas, so if it might not
+ * hold the glyphs of this frame, it is cleared and the frame is drawn
+ * completely. The history is checked only after the backend was prepared. */
+static void grid_prepare(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct atlas *atlas;
+
+	atlas = shl_dlist_first(&gt->atlases, struct atlas, list);
+	if (atlas->count - atlas->fill >= grid_reserve(txt, atlas))
+		return;
+
+	log_debug("grid atlas full, dropping %lu glyphs", gt->glyph_num);
+	drop_glyphs(txt, atlas);
+	memset(txt->history, 0, sizeof(txt->history));
+}
+
+static void grid_draw(struct kmscon_text *txt, const struct glyph *glyph,
+		      unsigned int width, unsigned int posx, unsigned int posy,
+		      const struct tsm_screen_attr *attr)
+{
+	struct gltex *gt = txt->data;
+	unsigned int i, slot, x1 = txt->cols, x2 = 0;
+	uint8_t *cell, val[8];
+
+	for (i = 0; i < width && posx + i < txt->cols; ++i) {
+		slot = glyph->texoff + i;
+		if (attr->inverse) {
+			val[0] = attr->br;
+			val[1] = attr->bg;
+			val[2] = attr->bb;
+			val[4] = attr->fr;
+			val[5] = attr->fg;
+			val[6] = attr->fb;
+		} else {
+			val[0] = attr->fr;
+			val[1] = attr->fg;
+			val[2] = attr->fb;
+			val[4] = attr->br;
+			val[5] = attr->bg;
+			val[6] = attr->bb;
+		}
+		val[3] = slot >> 8;
+		val[7] = slot & 0xff;
+
+		cell = &gt->grid_cells[(posy * txt->cols + posx + i) * 8];
+		if (!memcmp(cell, val, sizeof(val)))
+			continue;
+
+		memcpy(cell, val, sizeof(val));
+		if (x1 > posx + i)
+			x1 = posx + i;
+		x2 = posx + i + 1;
+	}
+
+	if (x1 >= x2)
+		return;
+
+	if (gt->grid_x1 > x1)
+		gt->grid_x1 = x1;
+	if (gt->grid_x2 < x2)
+		gt->grid_x2 = x2;
+	if (gt->grid_y1 > posy)
+		gt->grid_y1 = posy;
+	if (gt->grid_y2 < posy + 1)
+		gt->grid_y2 = posy + 1;
+}
+
+/* upload the cells drawn since the last frame with a single call */
+static void grid_upload(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	unsigned int x, y, width, height;
+
+	if (gt->grid_x1 >= gt->grid_x2)
+		return;
+
+	y = gt->grid_y1;
+	height = gt->grid_y2 - y;
+	if (gt->supports_rowlen) {
+		x = gt->grid_x1;
+		width = gt->grid_x2 - x;
+
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, txt->cols * 2);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x * 2, y, width * 2, height,
+				GL_RGBA, GL_UNSIGNED_BYTE,
+				&gt->grid_cells[(y * txt->cols + x) * 8]);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	} else {
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, txt->cols * 2, height,
+				GL_RGBA, GL_UNSIGNED_BYTE,
+				&gt->grid_cells[y * txt->cols * 8]);
+	}
+
+	gt->grid_x1 = txt->cols;
+	gt->grid_y1 = txt->rows;
+	gt->grid_x2 = 0;
+	gt->grid_y2 = 0;
+}
+
+static int grid_render(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct atlas *atlas;
+	GLfloat w, h, x, y, pos[8], texpos[8];
+
+	atlas = shl_dlist_first(&gt->atlases, struct atlas, list);
+
+	gl_clear_error();
+
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, gt->grid_tex);
+	grid_upload(txt);
+
+	gl_shader_use(gt->shader);
+
+	glViewport(0, 0, gt->sw, gt->sh);
+	glDisable(GL_BLEND);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, atlas->tex);
+	glUniform1i(gt->uni_atlas, 0);
+	glUniform1i(gt->uni_grid, 1);
+	glUniform2f(gt->uni_cell_size, gt->cell_width, gt->cell_height);
+	glUniform2f(gt->uni_grid_size, txt->cols, txt->rows);
+	glUniform2f(gt->uni_atlas_size, atlas->width, atlas->height);
+	glUniform1f(gt->uni_atlas_stride, atlas->stride);
+
+	/* one quad covering all cells with their pixel positions */
+	w = gt->cell_width * txt->cols;
+	h = gt->cell_height * txt->rows;
+	x = 2.0 / gt->sw * w - 1;
+	y = 1 - 2.0 / gt->sh * h;
+
+	pos[0] = -1;
+	pos[1] = 1;
+	pos[2] = -1;
+	pos[3] = y;
+	pos[4] = x;
+	pos[5] = 1;
+	pos[6] = x;
+	pos[7] = y;
+
+	texpos[0] = 0;
+	texpos[1] = 0;
+	texpos[2] = 0;
+	texpos[3] = h;
+	texpos[4] = w;
+	texpos[5] = 0;
+	texpos[6] = w;
+	texpos[7] = h;
+
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, pos);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, texpos);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+
+	if (gl_has_error(gt->shader)) {
+		log_warning("rendering console caused OpenGL errors");
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
 static int gltex_prepare(struct kmscon_text *txt)
 {
 	struct gltex *gt = txt->data;
@@ -536,9 +1280,15 @@ static int gltex_prepare(struct kmscon_text *txt)
 		atlas->cache_num = 0;
 	}
 
+	gt->epoch = kmscon_font_get_epoch();
+	gt->lru.limit = kmscon_font_get_cache_limit();
+
 	gt->advance_x = 2.0 / gt->sw * FONT_WIDTH(txt);
 	gt->advance_y = 2.0 / gt->sh * FONT_HEIGHT(txt);
 
+	if (gt->grid)
+		grid_prepare(txt);
+
 	return 0;
 }
 
@@ -561,9 +1311,17 @@ static int gltex_draw(struct kmscon_text *txt,
 		return ret;
 	atlas = glyph->atlas;
 
+	if (gt->grid) {
+		grid_draw(txt, glyph, width, posx, posy, attr);
+		return 0;
+	}
+
 	if (atlas->cache_num >= atlas->cache_size)
 		return -ERANGE;
 
+	if (atlas->lru.epoch != gt->epoch)
+		shl_lru_touch(&gt->lru, &atlas->lru, gt->epoch);
+
 	atlas->cache_pos[atlas->cache_num * 2 * 6 + 0] =
 		gt->advance_x * posx - 1;
 	atlas->cache_pos[atlas->cache_num * 2 * 6 + 1] =
@@ -628,12 +1386,99 @@ static int gltex_draw(struct kmscon_text *txt,
 	return 0;
 }
 
+/* Upload all staged glyphs. This does one glTexSubImage2D per dirty atlas which
+ * spans all glyph-rows that were added since the last flush. */
+static int flush_atlases(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct atlas *atlas;
+	struct shl_dlist *iter;
+	unsigned int x, y, width, height, first, last;
+	GLenum err;
+
+	gl_clear_error();
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	shl_dlist_for_each(iter, &gt->atlases) {
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+		if (atlas->dirty_start == atlas->dirty_end)
+			continue;
+
+		glBindTexture(GL_TEXTURE_2D, atlas->tex);
+
+		first = atlas->dirty_start / atlas->stride;
+		last = (atlas->dirty_end - 1) / atlas->stride;
+		y = gt->cell_height * first;
+		height = gt->cell_height * (last - first + 1);
+		if (y + height > atlas->height)
+			height = atlas->height - y;
+
+		/* Funnily, not all OpenGLESv2 implementations support
+		 * specifying the stride of a texture. In this case, or if the
+		 * glyphs span several slot rows, we upload the whole rows of
+		 * the staging buffer, which are contiguous in memory. This
+		 * uploads a few more bytes than necessary but it is still a
+		 * single call per atlas. */
+		if (gt->supports_rowlen && first == last) {
+			x = atlas->dirty_start % atlas->stride;
+			width = (atlas->dirty_end - 1) % atlas->stride + 1 - x;
+			x *= gt->cell_width;
+			width *= gt->cell_width;
+			if (x + width > atlas->width)
+				width = atlas->width - x;
+
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas->width);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, x, y,
+					width, height,
+					GL_ALPHA, GL_UNSIGNED_BYTE,
+					&atlas->stage[y * atlas->width + x]);
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		} else {
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y,
+					atlas->width, height,
+					GL_ALPHA, GL_UNSIGNED_BYTE,
+					&atlas->stage[y * atlas->width]);
+		}
+
+		atlas->dirty_start = 0;
+		atlas->dirty_end = 0;
+	}
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	/* Check for GL-errors
+	 * As OpenGL is a state-machine, we cannot really tell which call failed
+	 * without adding a glGetError() after each call. This is totally
+	 * overkill so let us at least catch the error afterwards.
+	 * We also add a hint to disable OpenGL if this does not work. This
+	 * should _always_ work but OpenGL is kind of a black-box that isn't
+	 * verbose at all and many things can go wrong. */
+
+	err = glGetError();
+	if (err != GL_NO_ERROR) {
+		gl_clear_error();
+		log_warning("cannot load glyph data into OpenGL texture (%d: %s); disable the GL-renderer if this does not work reliably",
+			    err, gl_err_to_str(err));
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
 static int gltex_render(struct kmscon_text *txt)
 {
 	struct gltex *gt = txt->data;
 	struct atlas *atlas;
 	struct shl_dlist *iter;
 	float mat[16];
+	int ret;
+
+	ret = flush_atlases(txt);
+	if (ret)
+		return ret;
+
+	if (gt->grid)
+		return grid_render(txt);
 
 	gl_clear_error();
 
@@ -652,6 +1497,7 @@ static int gltex_render(struct kmscon_text *txt)
 
 	glActiveTexture(GL_TEXTURE0);
 	glUniform1i(gt->uni_atlas, 0);
+	glUniform1f(gt->uni_sdf_smooth, gt->sdf ? gt->sdf_smooth : 0.0);
 
 	shl_dlist_for_each(iter, &gt->atlases) {
 		atlas = shl_dlist_entry(iter, struct atlas, list);
@@ -682,6 +1528,51 @@ static int gltex_render(struct kmscon_text *txt)
 	return 0;
 }
 
+/* Only SDF atlases are independent of the font size. Their glyphs are kept and
+ * just the vertex caches are resized for the new grid. */
+static int gltex_rescale(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct shl_dlist *iter;
+	struct atlas *atlas;
+	int ret;
+
+	if (!gt->sdf || txt->font->attr.italic != gt->sdf_font->attr.italic ||
+	    strcmp(txt->font->attr.name, gt->sdf_font->attr.name))
+		return -EOPNOTSUPP;
+
+	txt->cols = gt->sw / FONT_WIDTH(txt);
+	txt->rows = gt->sh / FONT_HEIGHT(txt);
+
+	shl_dlist_for_each(iter, &gt->atlases) {
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+		if (atlas->cache_size == txt->cols * txt->rows)
+			continue;
+
+		ret = alloc_cache(atlas, txt->cols * txt->rows);
+		if (ret)
+			return ret;
+	}
+
+	sdf_update_smooth(txt);
+	log_debug("rescaled SDF glyphs to %ux%u", FONT_WIDTH(txt),
+		  FONT_HEIGHT(txt));
+	return 0;
+}
+
+static void gltex_get_stats(struct kmscon_text *txt,
+			    struct kmscon_glyph_stats *stats)
+{
+	struct gltex *gt = txt->data;
+
+	stats->size = gt->lru.size;
+	stats->limit = gt->lru.limit;
+	stats->entries = gt->glyph_num;
+	stats->hits = gt->hits;
+	stats->misses = gt->misses;
+	stats->evictions = gt->evictions;
+}
+
 struct kmscon_text_ops kmscon_text_gltex_ops = {
 	.name = "gltex",
 	.owner = NULL,
@@ -693,4 +1584,38 @@ struct kmscon_text_ops kmscon_text_gltex_ops = {
 	.draw = gltex_draw,
 	.render = gltex_render,
 	.abort = NULL,
+	.get_stats = gltex_get_stats,
+	.flush = gltex_flush,
+};
+
+struct kmscon_text_ops kmscon_text_gltex_grid_ops = {
+	.name = "gltex-grid",
+	.owner = NULL,
+	.init = gltex_grid_init,
+	.destroy = gltex_destroy,
+	.set = gltex_set,
+	.unset = gltex_unset,
+	.prepare = gltex_prepare,
+	.draw = gltex_draw,
+	.render = gltex_render,
+	.abort = NULL,
+	.get_stats = gltex_get_stats,
+	.flush = gltex_flush,
+};
+
+/* glyphs come from the SDF reference fonts, so there is nothing to flush */
+struct kmscon_text_ops kmscon_text_gltex_sdf_ops = {
+	.name = "gltex-sdf",
+	.owner = NULL,
+	.init = gltex_sdf_init,
+	.destroy = gltex_destroy,
+	.set = gltex_set,
+	.unset = gltex_unset,
+	.prepare = gltex_prepare,
+	.draw = gltex_draw,
+	.render = gltex_render,
+	.abort = NULL,
+	.get_stats = gltex_get_stats,
+	.flush = NULL,
+	.rescale = gltex_rescale,
 };
@@ -28,6 +28,9 @@
  * Fragment Shader
  * A basic fragment shader which applies a 2D texture and blends foreground and
  * background colors.
+ * If sdf_smooth is not 0, the atlas stores signed distance fields with the
+ * outline at 0.5 and the coverage is computed from the interpolated distance
+ * with a transition of +-sdf_smooth.
  */
 
 precision mediump float;
@@ -35,6 +38,7 @@ precision mediump float;
 uniform sampler2D atlas;
 uniform float advance_htex;
 uniform float advance_vtex;
+uniform float sdf_smooth;
 
 varying vec2 texpos;
 varying vec3 fgcol;
@@ -44,6 +48,8 @@ void main()
 {
 	vec2 pos = vec2(texpos.x * advance_htex, texpos.y * advance_vtex);
 	float alpha = texture2D(atlas, pos).a;
+	if (sdf_smooth > 0.0)
+		alpha = smoothstep(0.5 - sdf_smooth, 0.5 + sdf_smooth, alpha);
 	vec3 val = alpha * fgcol + (1.0 - alpha) * bgcol;
 	gl_FragColor = vec4(val, 1.0);
 }
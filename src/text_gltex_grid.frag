@@ -0,0 +1,68 @@
+/*
+ * kmscon - Grid Fragment Shader
+ *
+ * Copyright (c) 2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Grid Fragment Shader
+ * Looks up the cell of each pixel in the grid texture and samples the glyph of
+ * that cell from the atlas. Each cell is stored as two texels. The rgb values
+ * of the first one are the foreground color, of the second one the background
+ * color. Their alpha values are the high and low byte of the glyph slot in the
+ * atlas. Slots are numbered row by row with atlas_stride slots per row.
+ * Pixel positions can exceed the range of mediump so highp is required. The
+ * grid mode is not used if fragment shaders lack highp, the mediump fallback
+ * only keeps this shader compiling on such implementations.
+ */
+
+#ifdef GL_FRAGMENT_PRECISION_HIGH
+precision highp float;
+#else
+precision mediump float;
+#endif
+
+uniform sampler2D atlas;
+uniform sampler2D grid;
+uniform vec2 cell_size;
+uniform vec2 grid_size;
+uniform vec2 atlas_size;
+uniform float atlas_stride;
+
+varying vec2 pixpos;
+
+void main()
+{
+	vec2 cell = floor(pixpos / cell_size);
+	vec2 off = pixpos - cell * cell_size;
+	float x = (cell.x * 2.0 + 0.5) / (grid_size.x * 2.0);
+	float y = (cell.y + 0.5) / grid_size.y;
+	vec4 fg = texture2D(grid, vec2(x, y));
+	vec4 bg = texture2D(grid, vec2(x + 1.0 / (grid_size.x * 2.0), y));
+	float slot = floor(fg.a * 255.0 + 0.5) * 256.0 +
+		     floor(bg.a * 255.0 + 0.5);
+	float sy = floor((slot + 0.5) / atlas_stride);
+	float sx = slot - sy * atlas_stride;
+	vec2 pos = (vec2(sx, sy) * cell_size + off) / atlas_size;
+	float alpha = texture2D(atlas, pos).a;
+	gl_FragColor = vec4(mix(bg.rgb, fg.rgb, alpha), 1.0);
+}
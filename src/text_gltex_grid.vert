@@ -1,8 +1,7 @@
 /*
- * kmscon - Vertex Shader
+ * kmscon - Grid Vertex Shader
  *
- * Copyright (c) 2011-2012 David Herrmann <dh.herrmann@googlemail.com>
- * Copyright (c) 2011 University of Tuebingen
+ * Copyright (c) 2013 David Herrmann <dh.herrmann@googlemail.com>
  *
  * Permission is hereby granted, free of charge, to any person obtaining
  * a copy of this software and associated documentation files
@@ -25,18 +24,18 @@
  */
 
 /*
- * Default Vertex Shader
- * This shader is a very basic vertex shader which forwards all data and
- * performs basic matrix multiplications.
+ * Grid Vertex Shader
+ * Forwards a single quad covering the whole console. The texture position is
+ * the pixel position relative to the top-left corner of the console.
  */
 
-uniform mat4 projection;
 attribute vec2 position;
-attribute vec4 color;
-varying vec4 col;
+attribute vec2 texture_position;
+
+varying vec2 pixpos;
 
 void main()
 {
-	col = color;
-	gl_Position = projection * vec4(position, 0.0, 1.0);
+	gl_Position = vec4(position, 0.0, 1.0);
+	pixpos = texture_position;
 }
@@ -32,29 +32,38 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
-#include "shl_hashtable.h"
 #include "shl_log.h"
+#include "shl_lru.h"
+#include "shl_u32map.h"
 #include "text.h"
 #include "uterm_video.h"
 
 #define LOG_SUBSYSTEM "text_pixman"
 
+/* Glyph bitmaps are always copied so the images do not reference font caches
+ * which may evict them later. */
 struct tp_glyph {
-	const struct kmscon_glyph *glyph;
+	struct shl_lru_entry lru;
+	uint32_t id;
+	bool bold;
 	pixman_image_t *surf;
 	uint8_t *data;
 };
 
+SHL_U32MAP_DEFINE(glyph_map, struct tp_glyph)
+
 struct tp_pixman {
 	pixman_image_t *white;
-	struct shl_hashtable *glyphs;
-	struct shl_hashtable *bold_glyphs;
+	struct glyph_map glyphs;
+	struct glyph_map bold_glyphs;
+	struct tp_glyph **fast;
+	struct tp_glyph **bold_fast;
+	struct shl_lru lru;
 
 	struct uterm_video_buffer buf[2];
 	pixman_image_t *surf[2];
 	unsigned int format[2];
 
-	bool new_stride;
 	bool use_indirect;
 	uint8_t *data[2];
 	struct uterm_video_buffer vbuf;
@@ -85,10 +94,8 @@ static void tp_destroy(struct kmscon_text *txt)
 	free(tp);
 }
 
-static void free_glyph(void *data)
+static void free_glyph(struct tp_glyph *glyph)
 {
-	struct tp_glyph *glyph = data;
-
 	pixman_image_unref(glyph->surf);
 	free(glyph->data);
 	free(glyph);
@@ -102,6 +109,7 @@ static unsigned int format_u2p(unsigned int f)
 	case UTERM_FORMAT_RGB16:
 		return PIXMAN_r5g6b5;
 	case UTERM_FORMAT_GREY:
+	case UTERM_FORMAT_MONO:
 		return PIXMAN_a8;
 	default:
 		return 0;
@@ -184,17 +192,14 @@ static int tp_set(struct kmscon_text *txt)
 		return -ENOMEM;
 	}
 
-	ret = shl_hashtable_new(&tp->glyphs, shl_direct_hash,
-				shl_direct_equal, NULL,
-				free_glyph);
-	if (ret)
-		goto err_white;
+	shl_lru_init(&tp->lru, kmscon_font_get_cache_limit());
 
-	ret = shl_hashtable_new(&tp->bold_glyphs, shl_direct_hash,
-				shl_direct_equal, NULL,
-				free_glyph);
-	if (ret)
-		goto err_htable;
+	tp->fast = calloc(KMSCON_GLYPH_FAST_NUM, sizeof(*tp->fast));
+	tp->bold_fast = calloc(KMSCON_GLYPH_FAST_NUM, sizeof(*tp->bold_fast));
+	if (!tp->fast || !tp->bold_fast) {
+		ret = -ENOMEM;
+		goto err_fast;
+	}
 
 	/*
 	 * TODO: It is actually faster to use a local shadow buffer and then
@@ -209,7 +214,7 @@ static int tp_set(struct kmscon_text *txt)
 			    txt->disp);
 		ret = alloc_indirect(txt, w, h);
 		if (ret)
-			goto err_htable_bold;
+			goto err_fast;
 	} else {
 		tp->format[0] = format_u2p(tp->buf[0].format);
 		tp->surf[0] = pixman_image_create_bits_no_clear(tp->format[0],
@@ -230,6 +235,10 @@ static int tp_set(struct kmscon_text *txt)
 	txt->cols = w / txt->font->attr.width;
 	txt->rows = h / txt->font->attr.height;
 
+	/* The shadow buffer does not follow the buffer-age of the display, so
+	 * rows can only be moved in the buffers of the display itself. */
+	txt->can_move = !tp->use_indirect;
+
 	return 0;
 
 err_ctx:
@@ -239,11 +248,9 @@ err_ctx:
 		pixman_image_unref(tp->surf[0]);
 	free(tp->data[1]);
 	free(tp->data[0]);
-err_htable_bold:
-	shl_hashtable_free(tp->bold_glyphs);
-err_htable:
-	shl_hashtable_free(tp->glyphs);
-err_white:
+err_fast:
+	free(tp->bold_fast);
+	free(tp->fast);
 	pixman_image_unref(tp->white);
 	return ret;
 }
@@ -252,39 +259,103 @@ static void tp_unset(struct kmscon_text *txt)
 {
 	struct tp_pixman *tp = txt->data;
 
+	log_debug("glyph cache: %lu glyphs, %zu bytes, %lu evictions",
+		  tp->lru.entries, tp->lru.size, tp->lru.evictions);
+
 	pixman_image_unref(tp->surf[1]);
 	pixman_image_unref(tp->surf[0]);
 	free(tp->data[1]);
 	free(tp->data[0]);
-	shl_hashtable_free(tp->bold_glyphs);
-	shl_hashtable_free(tp->glyphs);
+	free(tp->bold_fast);
+	free(tp->fast);
+	glyph_map_clear(&tp->bold_glyphs, free_glyph);
+	glyph_map_clear(&tp->glyphs, free_glyph);
 	pixman_image_unref(tp->white);
 }
 
+static void tp_evict(struct kmscon_text *txt)
+{
+	struct tp_pixman *tp = txt->data;
+	struct shl_lru_entry *e;
+	struct tp_glyph *glyph;
+	unsigned long epoch;
+
+	tp->lru.limit = kmscon_font_get_cache_limit();
+	epoch = kmscon_font_get_epoch();
+
+	while ((e = shl_lru_victim(&tp->lru, epoch))) {
+		glyph = shl_offsetof(e, struct tp_glyph, lru);
+		shl_lru_evict(&tp->lru, e);
+		if (glyph->id < KMSCON_GLYPH_FAST_NUM) {
+			if (glyph->bold)
+				tp->bold_fast[glyph->id] = NULL;
+			else
+				tp->fast[glyph->id] = NULL;
+		}
+		glyph_map_remove(glyph->bold ? &tp->bold_glyphs : &tp->glyphs,
+				 glyph->id);
+		free_glyph(glyph);
+	}
+}
+
+static void tp_flush(struct kmscon_text *txt)
+{
+	struct tp_pixman *tp = txt->data;
+	struct shl_lru_entry *e;
+	struct tp_glyph *glyph;
+
+	while (!shl_dlist_empty(&tp->lru.list)) {
+		e = shl_dlist_first(&tp->lru.list, struct shl_lru_entry, list);
+		glyph = shl_offsetof(e, struct tp_glyph, lru);
+		shl_lru_evict(&tp->lru, e);
+		if (glyph->id < KMSCON_GLYPH_FAST_NUM) {
+			if (glyph->bold)
+				tp->bold_fast[glyph->id] = NULL;
+			else
+				tp->fast[glyph->id] = NULL;
+		}
+		glyph_map_remove(glyph->bold ? &tp->bold_glyphs : &tp->glyphs,
+				 glyph->id);
+		free_glyph(glyph);
+	}
+}
+
 static int find_glyph(struct kmscon_text *txt, struct tp_glyph **out,
 		      uint32_t id, const uint32_t *ch, size_t len, bool bold)
 {
 	struct tp_pixman *tp = txt->data;
-	struct tp_glyph *glyph;
-	struct shl_hashtable *gtable;
+	struct tp_glyph *glyph, **fast;
+	struct glyph_map *gtable;
 	struct kmscon_font *font;
+	const struct kmscon_glyph *kglyph;
 	const struct uterm_video_buffer *buf;
 	uint8_t *dst, *src;
 	unsigned int format, i;
 	int ret, stride;
-	bool res;
 
 	if (bold) {
-		gtable = tp->bold_glyphs;
+		gtable = &tp->bold_glyphs;
+		fast = tp->bold_fast;
 		font = txt->bold_font;
 	} else {
-		gtable = tp->glyphs;
+		gtable = &tp->glyphs;
+		fast = tp->fast;
 		font = txt->font;
 	}
 
-	res = shl_hashtable_find(gtable, (void**)&glyph,
-				 (void*)(unsigned long)id);
-	if (res) {
+	if (id < KMSCON_GLYPH_FAST_NUM) {
+		glyph = fast[id];
+		if (glyph) {
+			shl_lru_mark(&tp->lru, &glyph->lru,
+				     kmscon_font_get_epoch());
+			*out = glyph;
+			return 0;
+		}
+	}
+
+	glyph = glyph_map_find(gtable, id);
+	if (glyph) {
+		shl_lru_touch(&tp->lru, &glyph->lru, kmscon_font_get_epoch());
 		*out = glyph;
 		return 0;
 	}
@@ -293,73 +364,73 @@ static int find_glyph(struct kmscon_text *txt, struct tp_glyph **out,
 	if (!glyph)
 		return -ENOMEM;
 	memset(glyph, 0, sizeof(*glyph));
+	glyph->id = id;
+	glyph->bold = bold;
 
 	if (!len)
-		ret = kmscon_font_render_empty(font, &glyph->glyph);
+		ret = kmscon_font_render_empty(font, &kglyph);
 	else
-		ret = kmscon_font_render(font, id, ch, len, &glyph->glyph);
+		ret = kmscon_font_render(font, id, ch, len, &kglyph);
 
 	if (ret) {
-		ret = kmscon_font_render_inval(font, &glyph->glyph);
+		ret = kmscon_font_render_inval(font, &kglyph);
 		if (ret)
 			goto err_free;
 	}
 
-	buf = &glyph->glyph->buf;
-	stride = buf->stride;
+	buf = &kglyph->buf;
+	stride = (buf->width + 3) & ~0x3;
 	format = format_u2p(buf->format);
-	glyph->surf = pixman_image_create_bits_no_clear(format,
-							buf->width,
-							buf->height,
-							(void*)buf->data,
-							buf->stride);
-	if (!glyph->surf) {
-		stride = (buf->stride + 3) & ~0x3;
-		if (!tp->new_stride) {
-			tp->new_stride = true;
-			log_debug("wrong stride, copy buffer (%d => %d)",
-			  buf->stride, stride);
-		}
 
-		glyph->data = malloc(stride * buf->height);
-		if (!glyph->data) {
-			log_error("cannot allocate memory for glyph storage");
-			ret = -ENOMEM;
-			goto err_free;
-		}
+	glyph->data = malloc(stride * buf->height);
+	if (!glyph->data) {
+		log_error("cannot allocate memory for glyph storage");
+		ret = -ENOMEM;
+		goto err_free;
+	}
 
-		src = buf->data;
-		dst = glyph->data;
-		for (i = 0; i < buf->height; ++i) {
+	src = buf->data;
+	dst = glyph->data;
+	/* mono glyphs are unpacked as pixman's a1 bit order differs */
+	for (i = 0; i < buf->height; ++i) {
+		if (buf->format == UTERM_FORMAT_MONO)
+			uterm_video_mono_to_grey(dst, src, buf->width);
+		else
 			memcpy(dst, src, buf->width);
-			dst += stride;
-			src += buf->stride;
-		}
-
-		glyph->surf = pixman_image_create_bits_no_clear(format,
-								buf->width,
-								buf->height,
-								(void*)
-								glyph->data,
-								stride);
+		dst += stride;
+		src += buf->stride;
 	}
+
+	glyph->surf = pixman_image_create_bits_no_clear(format,
+							buf->width,
+							buf->height,
+							(void*)glyph->data,
+							stride);
 	if (!glyph->surf) {
-		log_error("cannot create pixman-glyph: %d %p %d %d %d %d",
-			  ret, glyph->data ? glyph->data : buf->data, format,
-			  buf->width, buf->height, stride);
+		log_error("cannot create pixman-glyph: %p %d %d %d %d",
+			  glyph->data, format, buf->width, buf->height,
+			  stride);
 		ret = -EFAULT;
-		goto err_free;
+		goto err_data;
 	}
 
-	ret = shl_hashtable_insert(gtable, (void*)(long)id, glyph);
+	ret = glyph_map_insert(gtable, id, glyph);
 	if (ret)
 		goto err_pixman;
 
+	shl_lru_add(&tp->lru, &glyph->lru, sizeof(*glyph) +
+		    stride * buf->height, kmscon_font_get_epoch());
+	if (id < KMSCON_GLYPH_FAST_NUM)
+		fast[id] = glyph;
+	tp_evict(txt);
+
 	*out = glyph;
 	return 0;
 
 err_pixman:
 	pixman_image_unref(glyph->surf);
+err_data:
+	free(glyph->data);
 err_free:
 	free(glyph);
 	return ret;
@@ -470,6 +541,48 @@ static int tp_draw(struct kmscon_text *txt,
 	return 0;
 }
 
+static int tp_move_rows(struct kmscon_text *txt, unsigned int dst,
+			unsigned int src, unsigned int num)
+{
+	struct tp_pixman *tp = txt->data;
+	unsigned int fh = txt->font->attr.height, len, i;
+	uint8_t *from, *to;
+	int step;
+
+	len = txt->cols * txt->font->attr.width * tp->c_bpp / 8;
+	from = (uint8_t*)tp->c_data + src * fh * tp->c_stride;
+	to = (uint8_t*)tp->c_data + dst * fh * tp->c_stride;
+	step = tp->c_stride;
+
+	/* start with the last line if the rows move down */
+	if (dst > src) {
+		from += (num * fh - 1) * tp->c_stride;
+		to += (num * fh - 1) * tp->c_stride;
+		step = -step;
+	}
+
+	for (i = 0; i < num * fh; ++i) {
+		memmove(to, from, len);
+		from += step;
+		to += step;
+	}
+
+	return 0;
+}
+
+static void tp_get_stats(struct kmscon_text *txt,
+			 struct kmscon_glyph_stats *stats)
+{
+	struct tp_pixman *tp = txt->data;
+
+	stats->size = tp->lru.size;
+	stats->limit = tp->lru.limit;
+	stats->entries = tp->lru.entries;
+	stats->hits = shl_lru_get_hits(&tp->lru);
+	stats->misses = tp->lru.misses;
+	stats->evictions = tp->lru.evictions;
+}
+
 static int tp_render(struct kmscon_text *txt)
 {
 	struct tp_pixman *tp = txt->data;
@@ -499,4 +612,7 @@ struct kmscon_text_ops kmscon_text_pixman_ops = {
 	.draw = tp_draw,
 	.render = tp_render,
 	.abort = NULL,
+	.get_stats = tp_get_stats,
+	.flush = tp_flush,
+	.move_rows = tp_move_rows,
 };
@@ -45,6 +45,8 @@ struct uterm_drm2d_rb {
 struct uterm_drm2d_display {
 	int current_rb;
 	struct uterm_drm2d_rb rb[2];
+	unsigned long seq;
+	unsigned long seq_clear;
 };
 
 struct uterm_drm2d_video {
@@ -62,5 +64,9 @@ int uterm_drm2d_display_fill(struct uterm_display *disp,
 			     uint8_t r, uint8_t g, uint8_t b,
 			     unsigned int x, unsigned int y,
 			     unsigned int width, unsigned int height);
+int uterm_drm2d_display_copy(struct uterm_display *disp,
+			     unsigned int x, unsigned int y,
+			     unsigned int width, unsigned int height,
+			     unsigned int dst_x, unsigned int dst_y);
 
 #endif /* UTERM_DRM2D_INTERNAL_H */
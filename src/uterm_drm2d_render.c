@@ -93,17 +93,31 @@ int uterm_drm2d_display_blit(struct uterm_display *disp,
 	return 0;
 }
 
+static void fill_bg(uint8_t *dst, unsigned int stride, unsigned int width,
+		    unsigned int height, uint32_t val)
+{
+	unsigned int i;
+
+	while (height--) {
+		for (i = 0; i < width; ++i)
+			((uint32_t*)dst)[i] = val;
+		dst += stride;
+	}
+}
+
 int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
 				    const struct uterm_video_blend_req *req,
 				    size_t num)
 {
 	unsigned int tmp;
 	uint8_t *dst, *src;
-	unsigned int width, height, i, j;
+	unsigned int width, height, i, j, ix, iy;
 	unsigned int sw, sh;
 	uint_fast32_t r, g, b, out;
+	uint32_t bgval;
 	struct uterm_drm2d_rb *rb;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+	struct mono_lut lut = { .valid = false };
 
 	if (!req)
 		return -EINVAL;
@@ -116,7 +130,8 @@ int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
 		if (!req->buf)
 			continue;
 
-		if (req->buf->format != UTERM_FORMAT_GREY)
+		if (req->buf->format != UTERM_FORMAT_GREY &&
+		    req->buf->format != UTERM_FORMAT_MONO)
 			return -EOPNOTSUPP;
 
 		tmp = req->x + req->buf->width;
@@ -139,6 +154,28 @@ int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
 		dst = &dst[req->y * rb->stride + req->x * 4];
 		src = req->buf->data;
 
+		/* fill the cell once and blend the inked part only */
+		if (req->ink) {
+			bgval = (req->br << 16) | (req->bg << 8) | req->bb;
+			fill_bg(dst, rb->stride, width, height, bgval);
+			if (!blend_req_ink(req, &ix, &iy, &width, &height))
+				continue;
+			dst += iy * rb->stride + ix * 4;
+			if (req->buf->format == UTERM_FORMAT_MONO)
+				src += iy * req->buf->stride + ix / 8;
+			else
+				src += iy * req->buf->stride + ix;
+		}
+
+		if (req->buf->format == UTERM_FORMAT_MONO) {
+			mono_lut_update(&lut,
+					(req->fr << 16) | (req->fg << 8) | req->fb,
+					(req->br << 16) | (req->bg << 8) | req->bb);
+			mono_blend32(dst, rb->stride, src, req->buf->stride,
+				     width, height, &lut);
+			continue;
+		}
+
 		while (height--) {
 			for (i = 0; i < width; ++i) {
 				/* Division by 255 (t /= 255) is done with:
@@ -221,3 +258,59 @@ int uterm_drm2d_display_fill(struct uterm_display *disp,
 
 	return 0;
 }
+
+int uterm_drm2d_display_copy(struct uterm_display *disp,
+			     unsigned int x, unsigned int y,
+			     unsigned int width, unsigned int height,
+			     unsigned int dst_x, unsigned int dst_y)
+{
+	unsigned int tmp, i;
+	uint8_t *dst, *src;
+	unsigned int sw, sh;
+	struct uterm_drm2d_rb *rb;
+	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+
+	rb = &d2d->rb[d2d->current_rb ^ 1];
+	sw = uterm_drm_mode_get_width(disp->current_mode);
+	sh = uterm_drm_mode_get_height(disp->current_mode);
+
+	tmp = x + width;
+	if (tmp < x || x >= sw || dst_x >= sw)
+		return -EINVAL;
+	if (tmp > sw)
+		width = sw - x;
+	if (dst_x + width > sw)
+		width = sw - dst_x;
+	tmp = y + height;
+	if (tmp < y || y >= sh || dst_y >= sh)
+		return -EINVAL;
+	if (tmp > sh)
+		height = sh - y;
+	if (dst_y + height > sh)
+		height = sh - dst_y;
+
+	src = rb->map;
+	src = &src[y * rb->stride + x * 4];
+	dst = rb->map;
+	dst = &dst[dst_y * rb->stride + dst_x * 4];
+
+	/* copy in the direction that does not overwrite the source lines
+	 * before they were read */
+	if (dst_y > y) {
+		src += (height - 1) * rb->stride;
+		dst += (height - 1) * rb->stride;
+		for (i = 0; i < height; ++i) {
+			memmove(dst, src, width * 4);
+			dst -= rb->stride;
+			src -= rb->stride;
+		}
+	} else {
+		for (i = 0; i < height; ++i) {
+			memmove(dst, src, width * 4);
+			dst += rb->stride;
+			src += rb->stride;
+		}
+	}
+
+	return 0;
+}
@@ -177,6 +177,7 @@ static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
 		return ret;
 
 	d2d->current_rb = 0;
+	d2d->seq_clear = d2d->seq;
 	disp->current_mode = mode;
 
 	ret = init_rb(disp, &d2d->rb[0]);
@@ -268,9 +269,25 @@ static int display_swap(struct uterm_display *disp, bool immediate)
 		return ret;
 
 	d2d->current_rb = rb;
+	++d2d->seq;
 	return 0;
 }
 
+/* Both buffers are cleared on activation and are only written by us, so once
+ * two frames were swapped, the back-buffer always contains the frame before the
+ * last one. */
+static int display_get_buffer_age(struct uterm_display *disp,
+				  unsigned long *seq)
+{
+	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+
+	*seq = d2d->seq;
+	if (d2d->seq - d2d->seq_clear < 2)
+		return 0;
+
+	return 2;
+}
+
 static const struct display_ops drm2d_display_ops = {
 	.init = display_init,
 	.destroy = display_destroy,
@@ -280,9 +297,11 @@ static const struct display_ops drm2d_display_ops = {
 	.use = display_use,
 	.get_buffers = display_get_buffers,
 	.swap = display_swap,
+	.get_buffer_age = display_get_buffer_age,
 	.blit = uterm_drm2d_display_blit,
 	.fake_blendv = uterm_drm2d_display_fake_blendv,
 	.fill = uterm_drm2d_display_fill,
+	.copy = uterm_drm2d_display_copy,
 };
 
 static void show_displays(struct uterm_video *video)
@@ -312,6 +331,7 @@ static void show_displays(struct uterm_video *video)
 		d2d = uterm_drm_display_get_data(iter);
 		rb = &d2d->rb[d2d->current_rb];
 		memset(rb->map, 0, rb->size);
+		d2d->seq_clear = d2d->seq;
 		uterm_drm_display_wait_pflip(iter);
 	}
 }
@@ -33,10 +33,16 @@
 uniform mat4 projection;
 attribute vec2 position;
 attribute vec2 texture_position;
+attribute vec3 fgcolor;
+attribute vec3 bgcolor;
 varying vec2 texpos;
+varying vec3 fgcol;
+varying vec3 bgcol;
 
 void main()
 {
 	gl_Position = projection * vec4(position, 0.0, 1.0);
 	texpos = texture_position;
+	fgcol = fgcolor;
+	bgcol = bgcolor;
 }
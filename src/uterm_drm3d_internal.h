@@ -52,6 +52,10 @@
 #  define GL_UNPACK_ROW_LENGTH GL_UNPACK_ROW_LENGTH_EXT
 #endif
 
+#ifndef EGL_BUFFER_AGE_EXT
+#  define EGL_BUFFER_AGE_EXT 0x313D
+#endif
+
 struct uterm_drm3d_rb {
 	struct uterm_display *disp;
 	struct gbm_bo *bo;
@@ -63,8 +67,15 @@ struct uterm_drm3d_display {
 	EGLSurface surface;
 	struct uterm_drm3d_rb *current;
 	struct uterm_drm3d_rb *next;
+
+	unsigned long seq;
+	EGLint *damage;
+	size_t damage_num;
+	size_t damage_size;
 };
 
+struct uterm_drm3d_slot;
+
 struct uterm_drm3d_video {
 	struct gbm_device *gbm;
 	EGLDisplay disp;
@@ -73,16 +84,39 @@ struct uterm_drm3d_video {
 
 	unsigned int sinit;
 	bool supports_rowlen;
+	bool supports_age;
+	EGLBoolean (EGLAPIENTRYP swap_with_damage) (EGLDisplay dpy,
+						    EGLSurface surface,
+						    const EGLint *rects,
+						    EGLint n_rects);
+
 	GLuint tex;
+	unsigned int blit_width;
+	unsigned int blit_height;
+	uint8_t *repack;
+	size_t repack_size;
+
+	GLuint atlas;
+	GLuint glyph_tex;
+	unsigned int atlas_width;
+	unsigned int atlas_height;
+	unsigned int atlas_x;
+	unsigned int atlas_y;
+	unsigned int atlas_line;
+	uint8_t *atlas_stage;
+	struct uterm_drm3d_slot *slots;
+	unsigned int slot_count;
 
-	struct gl_shader *fill_shader;
-	GLuint uni_fill_proj;
+	struct uterm_display *batch_disp;
+	unsigned int batch_num;
+	GLfloat *batch_pos;
+	GLfloat *batch_texpos;
+	GLfloat *batch_fgcol;
+	GLfloat *batch_bgcol;
 
 	struct gl_shader *blend_shader;
 	GLuint uni_blend_proj;
 	GLuint uni_blend_tex;
-	GLuint uni_blend_fgcol;
-	GLuint uni_blend_bgcol;
 
 	struct gl_shader *blit_shader;
 	GLuint uni_blit_proj;
@@ -91,6 +125,8 @@ struct uterm_drm3d_video {
 
 int uterm_drm3d_display_use(struct uterm_display *disp, bool *opengl);
 void uterm_drm3d_deinit_shaders(struct uterm_video *video);
+int uterm_drm3d_display_flush(struct uterm_display *disp);
+void uterm_drm3d_display_drop(struct uterm_display *disp);
 int uterm_drm3d_display_blit(struct uterm_display *disp,
 			     const struct uterm_video_buffer *buf,
 			     unsigned int x, unsigned int y);
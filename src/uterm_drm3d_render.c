@@ -62,22 +62,48 @@ extern const char _binary_src_uterm_drm3d_blit_vert_bin_start[];
 extern const char _binary_src_uterm_drm3d_blit_vert_bin_end[];
 extern const char _binary_src_uterm_drm3d_blit_frag_bin_start[];
 extern const char _binary_src_uterm_drm3d_blit_frag_bin_end[];
-extern const char _binary_src_uterm_drm3d_fill_vert_bin_start[];
-extern const char _binary_src_uterm_drm3d_fill_vert_bin_end[];
-extern const char _binary_src_uterm_drm3d_fill_frag_bin_start[];
-extern const char _binary_src_uterm_drm3d_fill_frag_bin_end[];
+
+/*
+ * Blend and fill requests are not drawn immediately. Instead, we copy the
+ * glyphs into a temporary atlas and queue a textured quad per request. Fills
+ * are queued as quads that sample a reserved, always-transparent texel at the
+ * origin of the atlas so they can share the batch with blend requests and the
+ * order of all requests is preserved.
+ * The batch is flushed on swap, before any other GL user gets the context and
+ * whenever the atlas or the vertex arrays are full. The atlas is reset on each
+ * flush so we never keep pointers to glyph buffers across frames. Within a
+ * batch, a glyph may still be freed and its address reused by another one, so
+ * a buffer is only looked up by its address and verified against the copy in
+ * the atlas before it is reused.
+ * Glyphs that do not fit into the atlas at all are drawn on their own with a
+ * separate texture.
+ */
+
+#define BATCH_SIZE 4096
+#define SLOT_SIZE 4096
+#define ATLAS_SIZE 1024
+
+struct uterm_drm3d_slot {
+	const struct uterm_video_buffer *buf;
+	const uint8_t *data;
+	unsigned int width;
+	unsigned int height;
+	unsigned int x;
+	unsigned int y;
+};
 
 static int init_shaders(struct uterm_video *video)
 {
 	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(video);
 	int ret;
-	char *fill_attr[] = { "position", "color" };
-	char *blend_attr[] = { "position", "texture_position" };
+	char *blend_attr[] = { "position", "texture_position",
+			       "fgcolor", "bgcolor" };
 	char *blit_attr[] = { "position", "texture_position" };
-	int blend_vlen, blend_flen, blit_vlen, blit_flen, fill_vlen, fill_flen;
+	int blend_vlen, blend_flen, blit_vlen, blit_flen;
 	const char *blend_vert, *blend_frag;
 	const char *blit_vert, *blit_frag;
-	const char *fill_vert, *fill_frag;
+	GLint s;
+	GLenum err;
 
 	if (v3d->sinit == 1)
 		return -EFAULT;
@@ -94,22 +120,9 @@ static int init_shaders(struct uterm_video *video)
 	blit_vlen = _binary_src_uterm_drm3d_blit_vert_bin_end - blit_vert;
 	blit_frag = _binary_src_uterm_drm3d_blit_frag_bin_start;
 	blit_flen = _binary_src_uterm_drm3d_blit_frag_bin_end - blit_frag;
-	fill_vert = _binary_src_uterm_drm3d_fill_vert_bin_start;
-	fill_vlen = _binary_src_uterm_drm3d_fill_vert_bin_end - fill_vert;
-	fill_frag = _binary_src_uterm_drm3d_fill_frag_bin_start;
-	fill_flen = _binary_src_uterm_drm3d_fill_frag_bin_end - fill_frag;
-
-	ret = gl_shader_new(&v3d->fill_shader, fill_vert, fill_vlen,
-			    fill_frag, fill_flen, fill_attr, 2, log_llog,
-			    NULL);
-	if (ret)
-		return ret;
-
-	v3d->uni_fill_proj = gl_shader_get_uniform(v3d->fill_shader,
-						   "projection");
 
 	ret = gl_shader_new(&v3d->blend_shader, blend_vert, blend_vlen,
-			    blend_frag, blend_flen, blend_attr, 2, log_llog,
+			    blend_frag, blend_flen, blend_attr, 4, log_llog,
 			    NULL);
 	if (ret)
 		return ret;
@@ -118,10 +131,6 @@ static int init_shaders(struct uterm_video *video)
 						    "projection");
 	v3d->uni_blend_tex = gl_shader_get_uniform(v3d->blend_shader,
 						   "texture");
-	v3d->uni_blend_fgcol = gl_shader_get_uniform(v3d->blend_shader,
-						     "fgcolor");
-	v3d->uni_blend_bgcol = gl_shader_get_uniform(v3d->blend_shader,
-						     "bgcolor");
 
 	ret = gl_shader_new(&v3d->blit_shader, blit_vert, blit_vlen,
 			    blit_frag, blit_flen, blit_attr, 2, log_llog,
@@ -135,6 +144,53 @@ static int init_shaders(struct uterm_video *video)
 						  "texture");
 
 	gl_tex_new(&v3d->tex, 1);
+	gl_tex_new(&v3d->glyph_tex, 1);
+	glBindTexture(GL_TEXTURE_2D, v3d->glyph_tex);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &s);
+	if (s <= 0 || s > ATLAS_SIZE)
+		s = ATLAS_SIZE;
+	v3d->atlas_width = s;
+	v3d->atlas_height = s;
+
+	v3d->atlas_stage = malloc(s * s);
+	v3d->slots = malloc(sizeof(*v3d->slots) * SLOT_SIZE);
+	v3d->batch_pos = malloc(sizeof(GLfloat) * BATCH_SIZE * 2 * 6);
+	v3d->batch_texpos = malloc(sizeof(GLfloat) * BATCH_SIZE * 2 * 6);
+	v3d->batch_fgcol = malloc(sizeof(GLfloat) * BATCH_SIZE * 3 * 6);
+	v3d->batch_bgcol = malloc(sizeof(GLfloat) * BATCH_SIZE * 3 * 6);
+	if (!v3d->atlas_stage || !v3d->slots || !v3d->batch_pos ||
+	    !v3d->batch_texpos || !v3d->batch_fgcol || !v3d->batch_bgcol) {
+		log_error("cannot allocate memory for render batch");
+		return -ENOMEM;
+	}
+	memset(v3d->atlas_stage, 0, s * s);
+	memset(v3d->slots, 0, sizeof(*v3d->slots) * SLOT_SIZE);
+
+	gl_clear_error();
+
+	gl_tex_new(&v3d->atlas, 1);
+	glBindTexture(GL_TEXTURE_2D, v3d->atlas);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, s, s, 0, GL_ALPHA,
+		     GL_UNSIGNED_BYTE, NULL);
+
+	err = glGetError();
+	if (err != GL_NO_ERROR) {
+		gl_clear_error();
+		log_error("cannot create glyph atlas of size %dx%d (%d: %s)",
+			  s, s, err, gl_err_to_str(err));
+		return -EFAULT;
+	}
+
+	/* texel (0, 0) is reserved for fill requests */
+	v3d->atlas_x = 1;
+	v3d->atlas_line = 1;
 	v3d->sinit = 2;
 
 	return 0;
@@ -148,10 +204,404 @@ void uterm_drm3d_deinit_shaders(struct uterm_video *video)
 		return;
 
 	v3d->sinit = 0;
+	v3d->batch_disp = NULL;
+	v3d->batch_num = 0;
+	v3d->slot_count = 0;
+
+	free(v3d->batch_bgcol);
+	free(v3d->batch_fgcol);
+	free(v3d->batch_texpos);
+	free(v3d->batch_pos);
+	free(v3d->slots);
+	free(v3d->atlas_stage);
+	free(v3d->repack);
+	v3d->batch_bgcol = NULL;
+	v3d->batch_fgcol = NULL;
+	v3d->batch_texpos = NULL;
+	v3d->batch_pos = NULL;
+	v3d->slots = NULL;
+	v3d->atlas_stage = NULL;
+	v3d->repack = NULL;
+	v3d->repack_size = 0;
+	v3d->blit_width = 0;
+	v3d->blit_height = 0;
+
+	gl_tex_free(&v3d->atlas, 1);
+	gl_tex_free(&v3d->glyph_tex, 1);
 	gl_tex_free(&v3d->tex, 1);
 	gl_shader_unref(v3d->blit_shader);
 	gl_shader_unref(v3d->blend_shader);
-	gl_shader_unref(v3d->fill_shader);
+}
+
+static void reset_batch(struct uterm_drm3d_video *v3d)
+{
+	if (v3d->slot_count)
+		memset(v3d->slots, 0, sizeof(*v3d->slots) * SLOT_SIZE);
+
+	v3d->slot_count = 0;
+	v3d->atlas_x = 1;
+	v3d->atlas_y = 0;
+	v3d->atlas_line = 1;
+	v3d->batch_num = 0;
+	v3d->batch_disp = NULL;
+}
+
+static int activate_batch(struct uterm_drm3d_video *v3d)
+{
+	struct uterm_drm3d_display *d3d;
+
+	d3d = uterm_drm_display_get_data(v3d->batch_disp);
+	if (!eglMakeCurrent(v3d->disp, d3d->surface, d3d->surface,
+			    v3d->ctx)) {
+		log_error("cannot activate EGL context");
+		reset_batch(v3d);
+		return -EFAULT;
+	}
+
+	gl_clear_error();
+	return 0;
+}
+
+/* draw all queued quads with the texture bound to unit 0 and reset the batch */
+static int draw_batch(struct uterm_drm3d_video *v3d)
+{
+	struct uterm_display *disp = v3d->batch_disp;
+	unsigned int sw, sh, num = v3d->batch_num;
+	float mat[16];
+
+	sw = uterm_drm_mode_get_width(disp->current_mode);
+	sh = uterm_drm_mode_get_height(disp->current_mode);
+
+	glViewport(0, 0, sw, sh);
+	glDisable(GL_BLEND);
+
+	gl_shader_use(v3d->blend_shader);
+
+	/* map pixel coordinates with origin at the top-left corner */
+	gl_m4_identity(mat);
+	mat[0] = 2.0 / sw;
+	mat[5] = -2.0 / sh;
+	mat[12] = -1.0;
+	mat[13] = 1.0;
+	glUniformMatrix4fv(v3d->uni_blend_proj, 1, GL_FALSE, mat);
+	glUniform1i(v3d->uni_blend_tex, 0);
+
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, v3d->batch_pos);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, v3d->batch_texpos);
+	glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, v3d->batch_fgcol);
+	glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, 0, v3d->batch_bgcol);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(2);
+	glEnableVertexAttribArray(3);
+	glDrawArrays(GL_TRIANGLES, 0, 6 * num);
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+	glDisableVertexAttribArray(2);
+	glDisableVertexAttribArray(3);
+
+	reset_batch(v3d);
+
+	if (gl_has_error(v3d->blend_shader)) {
+		log_warning("GL error");
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static int flush_batch(struct uterm_drm3d_video *v3d)
+{
+	int ret;
+
+	if (!v3d->batch_disp)
+		return 0;
+
+	if (!v3d->batch_num) {
+		reset_batch(v3d);
+		return 0;
+	}
+
+	ret = activate_batch(v3d);
+	if (ret)
+		return ret;
+
+	/* upload all used atlas rows with a single call; the rows are
+	 * contiguous in the staging buffer so we need no row-length support */
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, v3d->atlas);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, v3d->atlas_width,
+			v3d->atlas_y + v3d->atlas_line, GL_ALPHA,
+			GL_UNSIGNED_BYTE, v3d->atlas_stage);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	return draw_batch(v3d);
+}
+
+/* flush pending requests of @disp, if any */
+int uterm_drm3d_display_flush(struct uterm_display *disp)
+{
+	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(disp->video);
+
+	if (v3d->batch_disp != disp)
+		return 0;
+
+	return flush_batch(v3d);
+}
+
+/* drop pending requests of @disp, used if its surface goes away */
+void uterm_drm3d_display_drop(struct uterm_display *disp)
+{
+	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(disp->video);
+
+	if (v3d->batch_disp == disp)
+		reset_batch(v3d);
+}
+
+static int begin_batch(struct uterm_display *disp)
+{
+	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(disp->video);
+	int ret;
+
+	if (v3d->batch_disp == disp)
+		return 0;
+
+	ret = flush_batch(v3d);
+	if (ret)
+		return ret;
+
+	if (v3d->sinit != 2) {
+		ret = uterm_drm3d_display_use(disp, NULL);
+		if (ret)
+			return ret;
+		ret = init_shaders(disp->video);
+		if (ret)
+			return ret;
+	}
+
+	v3d->batch_disp = disp;
+	return 0;
+}
+
+static inline unsigned int slot_hash(const void *key)
+{
+	return ((unsigned long)key >> 4) * 2654435761UL;
+}
+
+/* returns true if the atlas copy at @slot still matches the pixels of @buf */
+static bool slot_valid(struct uterm_drm3d_video *v3d,
+		       const struct uterm_drm3d_slot *slot,
+		       const struct uterm_video_buffer *buf)
+{
+	uint8_t row[ATLAS_SIZE];
+	const uint8_t *dst, *src;
+	unsigned int i;
+
+	if (slot->data != buf->data || slot->width != buf->width ||
+	    slot->height != buf->height)
+		return false;
+
+	src = buf->data;
+	dst = &v3d->atlas_stage[slot->y * v3d->atlas_width + slot->x];
+	for (i = 0; i < buf->height; ++i) {
+		if (buf->format == UTERM_FORMAT_MONO) {
+			uterm_video_mono_to_grey(row, src, buf->width);
+			if (memcmp(dst, row, buf->width))
+				return false;
+		} else if (memcmp(dst, src, buf->width)) {
+			return false;
+		}
+		dst += v3d->atlas_width;
+		src += buf->stride;
+	}
+
+	return true;
+}
+
+/* Find @buf in the atlas or copy it into the next free position. Returns
+ * -ENOSPC if the atlas must be flushed first and -E2BIG if @buf can never fit
+ * into the atlas. */
+static int atlas_add(struct uterm_drm3d_video *v3d,
+		     const struct uterm_video_buffer *buf,
+		     unsigned int *x, unsigned int *y)
+{
+	struct uterm_drm3d_slot *slot;
+	unsigned int idx, i, width = buf->width, height = buf->height;
+	uint8_t *dst, *src;
+	bool found = false;
+
+	/* keep a margin for the reserved texel so this fits after a flush */
+	if (width >= v3d->atlas_width || height >= v3d->atlas_height)
+		return -E2BIG;
+
+	idx = slot_hash(buf) & (SLOT_SIZE - 1);
+	while (v3d->slots[idx].buf) {
+		if (v3d->slots[idx].buf == buf) {
+			/* the address may have been reused by another glyph */
+			if (slot_valid(v3d, &v3d->slots[idx], buf)) {
+				*x = v3d->slots[idx].x;
+				*y = v3d->slots[idx].y;
+				return 0;
+			}
+			found = true;
+			break;
+		}
+		idx = (idx + 1) & (SLOT_SIZE - 1);
+	}
+
+	if (!found && v3d->slot_count >= SLOT_SIZE / 2)
+		return -ENOSPC;
+
+	if (v3d->atlas_x + width > v3d->atlas_width) {
+		v3d->atlas_y += v3d->atlas_line;
+		v3d->atlas_x = 0;
+		v3d->atlas_line = 0;
+	}
+	if (v3d->atlas_y + height > v3d->atlas_height)
+		return -ENOSPC;
+
+	src = buf->data;
+	dst = &v3d->atlas_stage[v3d->atlas_y * v3d->atlas_width +
+				v3d->atlas_x];
+	for (i = 0; i < height; ++i) {
+		if (buf->format == UTERM_FORMAT_MONO)
+			uterm_video_mono_to_grey(dst, src, width);
+		else
+			memcpy(dst, src, width);
+		dst += v3d->atlas_width;
+		src += buf->stride;
+	}
+
+	slot = &v3d->slots[idx];
+	slot->buf = buf;
+	slot->data = buf->data;
+	slot->width = width;
+	slot->height = height;
+	slot->x = v3d->atlas_x;
+	slot->y = v3d->atlas_y;
+	if (!found)
+		++v3d->slot_count;
+
+	*x = v3d->atlas_x;
+	*y = v3d->atlas_y;
+	v3d->atlas_x += width;
+	if (height > v3d->atlas_line)
+		v3d->atlas_line = height;
+
+	return 0;
+}
+
+static void batch_add(struct uterm_drm3d_video *v3d,
+		      unsigned int x, unsigned int y,
+		      unsigned int width, unsigned int height,
+		      float s0, float t0, float s1, float t1,
+		      uint8_t fr, uint8_t fg, uint8_t fb,
+		      uint8_t br, uint8_t bg, uint8_t bb)
+{
+	GLfloat *pos, *tex, *fgcol, *bgcol;
+	float x0 = x, y0 = y, x1 = x + width, y1 = y + height;
+	unsigned int i;
+
+	pos = &v3d->batch_pos[v3d->batch_num * 2 * 6];
+	tex = &v3d->batch_texpos[v3d->batch_num * 2 * 6];
+	fgcol = &v3d->batch_fgcol[v3d->batch_num * 3 * 6];
+	bgcol = &v3d->batch_bgcol[v3d->batch_num * 3 * 6];
+
+	pos[0] = x0;
+	pos[1] = y0;
+	pos[2] = x0;
+	pos[3] = y1;
+	pos[4] = x1;
+	pos[5] = y1;
+
+	pos[6] = x0;
+	pos[7] = y0;
+	pos[8] = x1;
+	pos[9] = y1;
+	pos[10] = x1;
+	pos[11] = y0;
+
+	tex[0] = s0;
+	tex[1] = t0;
+	tex[2] = s0;
+	tex[3] = t1;
+	tex[4] = s1;
+	tex[5] = t1;
+
+	tex[6] = s0;
+	tex[7] = t0;
+	tex[8] = s1;
+	tex[9] = t1;
+	tex[10] = s1;
+	tex[11] = t0;
+
+	for (i = 0; i < 6; ++i) {
+		fgcol[i * 3 + 0] = fr / 255.0;
+		fgcol[i * 3 + 1] = fg / 255.0;
+		fgcol[i * 3 + 2] = fb / 255.0;
+		bgcol[i * 3 + 0] = br / 255.0;
+		bgcol[i * 3 + 1] = bg / 255.0;
+		bgcol[i * 3 + 2] = bb / 255.0;
+	}
+
+	++v3d->batch_num;
+}
+
+/*
+ * The blit texture is kept across frames and mirrors the display, so each blit
+ * only uploads the rectangle it covers. The storage is reallocated only if a
+ * display bigger than the current storage is used.
+ */
+static int prepare_blit_tex(struct uterm_drm3d_video *v3d,
+			    unsigned int sw, unsigned int sh)
+{
+	GLenum err;
+
+	if (sw <= v3d->blit_width && sh <= v3d->blit_height)
+		return 0;
+
+	if (sw < v3d->blit_width)
+		sw = v3d->blit_width;
+	if (sh < v3d->blit_height)
+		sh = v3d->blit_height;
+
+	gl_clear_error();
+
+	glBindTexture(GL_TEXTURE_2D, v3d->tex);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_BGRA_EXT, sw, sh, 0,
+		     GL_BGRA_EXT, GL_UNSIGNED_BYTE, NULL);
+
+	err = glGetError();
+	if (err != GL_NO_ERROR) {
+		gl_clear_error();
+		log_warning("cannot allocate blit texture of size %ux%u (%d: %s)",
+			    sw, sh, err, gl_err_to_str(err));
+		v3d->blit_width = 0;
+		v3d->blit_height = 0;
+		return -EFAULT;
+	}
+
+	v3d->blit_width = sw;
+	v3d->blit_height = sh;
+	return 0;
+}
+
+/* returns a buffer of at least @size bytes that is kept for the next blit */
+static uint8_t *get_repack_buf(struct uterm_drm3d_video *v3d, size_t size)
+{
+	uint8_t *tmp;
+
+	if (size <= v3d->repack_size)
+		return v3d->repack;
+
+	tmp = realloc(v3d->repack, size);
+	if (!tmp)
+		return NULL;
+
+	v3d->repack = tmp;
+	v3d->repack_size = size;
+	return tmp;
 }
 
 int uterm_drm3d_display_blit(struct uterm_display *disp,
@@ -161,7 +611,7 @@ int uterm_drm3d_display_blit(struct uterm_display *disp,
 	struct uterm_drm3d_video *v3d;
 	unsigned int sw, sh, tmp, width, height, i;
 	float mat[16];
-	float vertices[6 * 2], texpos[6 * 2];
+	float vertices[6 * 2], texpos[6 * 2], s0, t0, s1, t1;
 	int ret;
 	uint8_t *packed, *src, *dst;
 
@@ -179,34 +629,6 @@ int uterm_drm3d_display_blit(struct uterm_display *disp,
 	sw = uterm_drm_mode_get_width(disp->current_mode);
 	sh = uterm_drm_mode_get_height(disp->current_mode);
 
-	vertices[0] = -1.0;
-	vertices[1] = -1.0;
-	vertices[2] = -1.0;
-	vertices[3] = +1.0;
-	vertices[4] = +1.0;
-	vertices[5] = +1.0;
-
-	vertices[6] = -1.0;
-	vertices[7] = -1.0;
-	vertices[8] = +1.0;
-	vertices[9] = +1.0;
-	vertices[10] = +1.0;
-	vertices[11] = -1.0;
-
-	texpos[0] = 0.0;
-	texpos[1] = 1.0;
-	texpos[2] = 0.0;
-	texpos[3] = 0.0;
-	texpos[4] = 1.0;
-	texpos[5] = 0.0;
-
-	texpos[6] = 0.0;
-	texpos[7] = 1.0;
-	texpos[8] = 1.0;
-	texpos[9] = 0.0;
-	texpos[10] = 1.0;
-	texpos[11] = 1.0;
-
 	tmp = x + buf->width;
 	if (tmp < x || x >= sw)
 		return -EINVAL;
@@ -223,6 +645,43 @@ int uterm_drm3d_display_blit(struct uterm_display *disp,
 	else
 		height = buf->height;
 
+	ret = prepare_blit_tex(v3d, sw, sh);
+	if (ret)
+		return ret;
+
+	s0 = (float)x / v3d->blit_width;
+	t0 = (float)y / v3d->blit_height;
+	s1 = (float)(x + width) / v3d->blit_width;
+	t1 = (float)(y + height) / v3d->blit_height;
+
+	vertices[0] = -1.0;
+	vertices[1] = -1.0;
+	vertices[2] = -1.0;
+	vertices[3] = +1.0;
+	vertices[4] = +1.0;
+	vertices[5] = +1.0;
+
+	vertices[6] = -1.0;
+	vertices[7] = -1.0;
+	vertices[8] = +1.0;
+	vertices[9] = +1.0;
+	vertices[10] = +1.0;
+	vertices[11] = -1.0;
+
+	texpos[0] = s0;
+	texpos[1] = t1;
+	texpos[2] = s0;
+	texpos[3] = t0;
+	texpos[4] = s1;
+	texpos[5] = t0;
+
+	texpos[6] = s0;
+	texpos[7] = t1;
+	texpos[8] = s1;
+	texpos[9] = t0;
+	texpos[10] = s1;
+	texpos[11] = t1;
+
 	glViewport(x, sh - y - height, width, height);
 	glDisable(GL_BLEND);
 
@@ -237,14 +696,14 @@ int uterm_drm3d_display_blit(struct uterm_display *disp,
 
 	if (v3d->supports_rowlen) {
 		glPixelStorei(GL_UNPACK_ROW_LENGTH, buf->stride / 4);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_BGRA_EXT, width, height, 0,
-			     GL_BGRA_EXT, GL_UNSIGNED_BYTE, buf->data);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height,
+				GL_BGRA_EXT, GL_UNSIGNED_BYTE, buf->data);
 		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-	} else if (buf->stride == width) {
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_BGRA_EXT, width, height, 0,
-			     GL_BGRA_EXT, GL_UNSIGNED_BYTE, buf->data);
+	} else if (buf->stride == width * 4) {
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height,
+				GL_BGRA_EXT, GL_UNSIGNED_BYTE, buf->data);
 	} else {
-		packed = malloc(width * height);
+		packed = get_repack_buf(v3d, width * height * 4);
 		if (!packed)
 			return -ENOMEM;
 
@@ -256,10 +715,8 @@ int uterm_drm3d_display_blit(struct uterm_display *disp,
 			src += buf->stride;
 		}
 
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_BGRA_EXT, width, height, 0,
-			     GL_BGRA_EXT, GL_UNSIGNED_BYTE, packed);
-
-		free(packed);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height,
+				GL_BGRA_EXT, GL_UNSIGNED_BYTE, packed);
 	}
 
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
@@ -281,6 +738,59 @@ int uterm_drm3d_display_blit(struct uterm_display *disp,
 	return 0;
 }
 
+/* Draw @buf on its own, used for glyphs that are too big for the atlas. The
+ * pending batch is flushed first to keep the order of requests. */
+static int blend_direct(struct uterm_drm3d_video *v3d,
+			struct uterm_display *disp,
+			const struct uterm_video_buffer *buf,
+			unsigned int x, unsigned int y,
+			unsigned int width, unsigned int height,
+			uint8_t fr, uint8_t fg, uint8_t fb,
+			uint8_t br, uint8_t bg, uint8_t bb)
+{
+	uint8_t *packed, *src, *dst;
+	unsigned int i;
+	int ret;
+
+	ret = flush_batch(v3d);
+	if (ret)
+		return ret;
+
+	v3d->batch_disp = disp;
+	ret = activate_batch(v3d);
+	if (ret)
+		return ret;
+
+	packed = get_repack_buf(v3d, width * height);
+	if (!packed) {
+		reset_batch(v3d);
+		return -ENOMEM;
+	}
+
+	src = buf->data;
+	dst = packed;
+	for (i = 0; i < height; ++i) {
+		if (buf->format == UTERM_FORMAT_MONO)
+			uterm_video_mono_to_grey(dst, src, width);
+		else
+			memcpy(dst, src, width);
+		dst += width;
+		src += buf->stride;
+	}
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, v3d->glyph_tex);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0, GL_ALPHA,
+		     GL_UNSIGNED_BYTE, packed);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	batch_add(v3d, x, y, width, height, 0.0, 0.0, 1.0, 1.0,
+		  fr, fg, fb, br, bg, bb);
+
+	return draw_batch(v3d);
+}
+
 static int display_blend(struct uterm_display *disp,
 			 const struct uterm_video_buffer *buf,
 			 unsigned int x, unsigned int y,
@@ -288,61 +798,21 @@ static int display_blend(struct uterm_display *disp,
 			 uint8_t br, uint8_t bg, uint8_t bb)
 {
 	struct uterm_drm3d_video *v3d;
-	unsigned int sw, sh, tmp, width, height, i;
-	float mat[16];
-	float vertices[6 * 2], texpos[6 * 2], fgcol[3], bgcol[3];
+	unsigned int sw, sh, tmp, width, height, tx, ty;
 	int ret;
-	uint8_t *packed, *src, *dst;
 
-	if (!buf || buf->format != UTERM_FORMAT_GREY)
+	if (!buf || (buf->format != UTERM_FORMAT_GREY &&
+		     buf->format != UTERM_FORMAT_MONO))
 		return -EINVAL;
 
 	v3d = uterm_drm_video_get_data(disp->video);
-	ret = uterm_drm3d_display_use(disp, NULL);
-	if (ret)
-		return ret;
-	ret = init_shaders(disp->video);
+	ret = begin_batch(disp);
 	if (ret)
 		return ret;
 
 	sw = uterm_drm_mode_get_width(disp->current_mode);
 	sh = uterm_drm_mode_get_height(disp->current_mode);
 
-	vertices[0] = -1.0;
-	vertices[1] = -1.0;
-	vertices[2] = -1.0;
-	vertices[3] = +1.0;
-	vertices[4] = +1.0;
-	vertices[5] = +1.0;
-
-	vertices[6] = -1.0;
-	vertices[7] = -1.0;
-	vertices[8] = +1.0;
-	vertices[9] = +1.0;
-	vertices[10] = +1.0;
-	vertices[11] = -1.0;
-
-	texpos[0] = 0.0;
-	texpos[1] = 1.0;
-	texpos[2] = 0.0;
-	texpos[3] = 0.0;
-	texpos[4] = 1.0;
-	texpos[5] = 0.0;
-
-	texpos[6] = 0.0;
-	texpos[7] = 1.0;
-	texpos[8] = 1.0;
-	texpos[9] = 0.0;
-	texpos[10] = 1.0;
-	texpos[11] = 1.0;
-
-	fgcol[0] = fr / 255.0;
-	fgcol[1] = fg / 255.0;
-	fgcol[2] = fb / 255.0;
-	bgcol[0] = br / 255.0;
-	bgcol[1] = bg / 255.0;
-	bgcol[2] = bb / 255.0;
-
 	tmp = x + buf->width;
 	if (tmp < x || x >= sw)
 		return -EINVAL;
@@ -359,63 +829,33 @@ static int display_blend(struct uterm_display *disp,
 	else
 		height = buf->height;
 
-	glViewport(x, sh - y - height, width, height);
-	glDisable(GL_BLEND);
-
-	gl_shader_use(v3d->blend_shader);
-
-	gl_m4_identity(mat);
-	glUniformMatrix4fv(v3d->uni_blend_proj, 1, GL_FALSE, mat);
-
-	glUniform3fv(v3d->uni_blend_fgcol, 1, fgcol);
-	glUniform3fv(v3d->uni_blend_bgcol, 1, bgcol);
-
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, v3d->tex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
-	if (v3d->supports_rowlen) {
-		glPixelStorei(GL_UNPACK_ROW_LENGTH, buf->stride);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0,
-			     GL_ALPHA, GL_UNSIGNED_BYTE, buf->data);
-		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-	} else if (buf->stride == width) {
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0,
-			     GL_ALPHA, GL_UNSIGNED_BYTE, buf->data);
-	} else {
-		packed = malloc(width * height);
-		if (!packed)
-			return -ENOMEM;
-
-		src = buf->data;
-		dst = packed;
-		for (i = 0; i < height; ++i) {
-			memcpy(dst, src, width);
-			dst += width;
-			src += buf->stride;
-		}
-
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0,
-			     GL_ALPHA, GL_UNSIGNED_BYTE, packed);
-
-		free(packed);
+	if (v3d->batch_num >= BATCH_SIZE) {
+		ret = flush_batch(v3d);
+		if (ret)
+			return ret;
+		v3d->batch_disp = disp;
 	}
 
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-	glUniform1i(v3d->uni_blend_tex, 0);
-
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, vertices);
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, texpos);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
-	glDisableVertexAttribArray(0);
-	glDisableVertexAttribArray(1);
-
-	if (gl_has_error(v3d->blend_shader)) {
-		log_warning("GL error");
-		return -EFAULT;
+	ret = atlas_add(v3d, buf, &tx, &ty);
+	if (ret == -ENOSPC) {
+		ret = flush_batch(v3d);
+		if (ret)
+			return ret;
+		v3d->batch_disp = disp;
+		ret = atlas_add(v3d, buf, &tx, &ty);
 	}
+	if (ret == -E2BIG)
+		return blend_direct(v3d, disp, buf, x, y, width, height,
+				    fr, fg, fb, br, bg, bb);
+	if (ret)
+		return ret;
+
+	batch_add(v3d, x, y, width, height,
+		  (float)tx / v3d->atlas_width,
+		  (float)ty / v3d->atlas_height,
+		  (float)(tx + width) / v3d->atlas_width,
+		  (float)(ty + height) / v3d->atlas_height,
+		  fr, fg, fb, br, bg, bb);
 
 	return 0;
 }
@@ -450,43 +890,18 @@ int uterm_drm3d_display_fill(struct uterm_display *disp,
 			     unsigned int width, unsigned int height)
 {
 	struct uterm_drm3d_video *v3d;
-	unsigned int sw, sh, tmp, i;
-	float mat[16];
-	float vertices[6 * 2], colors[6 * 4];
+	unsigned int sw, sh, tmp;
+	float s, t;
 	int ret;
 
 	v3d = uterm_drm_video_get_data(disp->video);
-	ret = uterm_drm3d_display_use(disp, NULL);
-	if (ret)
-		return ret;
-	ret = init_shaders(disp->video);
+	ret = begin_batch(disp);
 	if (ret)
 		return ret;
 
 	sw = uterm_drm_mode_get_width(disp->current_mode);
 	sh = uterm_drm_mode_get_height(disp->current_mode);
 
-	for (i = 0; i < 6; ++i) {
-		colors[i * 4 + 0] = r / 255.0;
-		colors[i * 4 + 1] = g / 255.0;
-		colors[i * 4 + 2] = b / 255.0;
-		colors[i * 4 + 3] = 1.0;
-	}
-
-	vertices[0] = -1.0;
-	vertices[1] = -1.0;
-	vertices[2] = -1.0;
-	vertices[3] = +1.0;
-	vertices[4] = +1.0;
-	vertices[5] = +1.0;
-
-	vertices[6] = -1.0;
-	vertices[7] = -1.0;
-	vertices[8] = +1.0;
-	vertices[9] = +1.0;
-	vertices[10] = +1.0;
-	vertices[11] = -1.0;
-
 	tmp = x + width;
 	if (tmp < x || x >= sw)
 		return -EINVAL;
@@ -498,24 +913,18 @@ int uterm_drm3d_display_fill(struct uterm_display *disp,
 	if (tmp > sh)
 		height = sh - y;
 
-	glViewport(x, y, width, height);
-	glDisable(GL_BLEND);
-
-	gl_shader_use(v3d->fill_shader);
-	gl_m4_identity(mat);
-	glUniformMatrix4fv(v3d->uni_fill_proj, 1, GL_FALSE, mat);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, vertices);
-	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 0, colors);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
-	glDisableVertexAttribArray(0);
-	glDisableVertexAttribArray(1);
-
-	if (gl_has_error(v3d->fill_shader)) {
-		log_warning("GL error");
-		return -EFAULT;
+	if (v3d->batch_num >= BATCH_SIZE) {
+		ret = flush_batch(v3d);
+		if (ret)
+			return ret;
+		v3d->batch_disp = disp;
 	}
 
+	/* sample the center of the reserved transparent texel */
+	s = 0.5 / v3d->atlas_width;
+	t = 0.5 / v3d->atlas_height;
+	batch_add(v3d, x, y, width, height, s, t, s, t,
+		  r, g, b, r, g, b);
+
 	return 0;
 }
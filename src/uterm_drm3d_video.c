@@ -75,7 +75,10 @@ static int display_init(struct uterm_display *disp)
 
 static void display_destroy(struct uterm_display *disp)
 {
-	free(uterm_drm_display_get_data(disp));
+	struct uterm_drm3d_display *d3d = uterm_drm_display_get_data(disp);
+
+	free(d3d->damage);
+	free(d3d);
 	uterm_drm_display_destroy(disp);
 }
 
@@ -196,6 +199,8 @@ static int display_activate(struct uterm_display *disp,
 		ret = -EFAULT;
 		goto err_noctx;
 	}
+	++d3d->seq;
+	d3d->damage_num = 0;
 
 	bo = gbm_surface_lock_front_buffer(d3d->gbm);
 	if (!bo) {
@@ -248,6 +253,7 @@ static void display_deactivate(struct uterm_display *disp)
 
 	vdrm = video->data;
 	v3d = uterm_drm_video_get_data(video);
+	uterm_drm3d_display_drop(disp);
 	uterm_drm_display_deactivate(disp, vdrm->fd);
 
 	eglMakeCurrent(v3d->disp, EGL_NO_SURFACE, EGL_NO_SURFACE,
@@ -274,6 +280,10 @@ int uterm_drm3d_display_use(struct uterm_display *disp, bool *opengl)
 	struct uterm_drm3d_display *d3d = uterm_drm_display_get_data(disp);
 	struct uterm_drm3d_video *v3d;
 
+	/* pending blend/fill requests must be drawn before anyone else
+	 * renders into this surface */
+	uterm_drm3d_display_flush(disp);
+
 	v3d = uterm_drm_video_get_data(disp->video);
 	if (!eglMakeCurrent(v3d->disp, d3d->surface,
 			    d3d->surface, v3d->ctx)) {
@@ -291,6 +301,7 @@ int uterm_drm3d_display_use(struct uterm_display *disp, bool *opengl)
 static int display_swap(struct uterm_display *disp, bool immediate)
 {
 	int ret;
+	EGLBoolean b;
 	struct gbm_bo *bo;
 	struct uterm_drm3d_rb *rb;
 	struct uterm_drm3d_display *d3d = uterm_drm_display_get_data(disp);
@@ -300,10 +311,22 @@ static int display_swap(struct uterm_display *disp, bool immediate)
 	if (!gbm_surface_has_free_buffers(d3d->gbm))
 		return -EBUSY;
 
-	if (!eglSwapBuffers(v3d->disp, d3d->surface)) {
+	ret = uterm_drm3d_display_flush(disp);
+	if (ret)
+		log_warning("cannot flush pending requests before swap");
+
+	if (d3d->damage_num && v3d->swap_with_damage)
+		b = v3d->swap_with_damage(v3d->disp, d3d->surface,
+					  d3d->damage, d3d->damage_num);
+	else
+		b = eglSwapBuffers(v3d->disp, d3d->surface);
+
+	d3d->damage_num = 0;
+	if (!b) {
 		log_error("cannot swap EGL buffers (%d): %m", errno);
 		return -EFAULT;
 	}
+	++d3d->seq;
 
 	bo = gbm_surface_lock_front_buffer(d3d->gbm);
 	if (!bo) {
@@ -340,6 +363,59 @@ static int display_swap(struct uterm_display *disp, bool immediate)
 	return 0;
 }
 
+static int display_get_buffer_age(struct uterm_display *disp,
+				  unsigned long *seq)
+{
+	struct uterm_drm3d_display *d3d = uterm_drm_display_get_data(disp);
+	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(disp->video);
+	EGLint age = 0;
+
+	*seq = d3d->seq;
+	if (!v3d->supports_age)
+		return 0;
+
+	if (!eglQuerySurface(v3d->disp, d3d->surface, EGL_BUFFER_AGE_EXT,
+			     &age) || age < 0)
+		return 0;
+
+	return age;
+}
+
+static int display_set_damage(struct uterm_display *disp,
+			      const struct uterm_video_rect *rects,
+			      size_t num)
+{
+	struct uterm_drm3d_display *d3d = uterm_drm_display_get_data(disp);
+	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(disp->video);
+	unsigned int sh;
+	EGLint *tmp;
+	size_t i;
+
+	d3d->damage_num = 0;
+	if (!v3d->swap_with_damage || !num)
+		return 0;
+
+	if (num > d3d->damage_size) {
+		tmp = realloc(d3d->damage, sizeof(*tmp) * 4 * num);
+		if (!tmp)
+			return -ENOMEM;
+		d3d->damage = tmp;
+		d3d->damage_size = num;
+	}
+
+	/* EGL uses a bottom-left origin */
+	sh = uterm_drm_mode_get_height(disp->current_mode);
+	for (i = 0; i < num; ++i) {
+		d3d->damage[i * 4 + 0] = rects[i].x;
+		d3d->damage[i * 4 + 1] = sh - rects[i].y - rects[i].height;
+		d3d->damage[i * 4 + 2] = rects[i].width;
+		d3d->damage[i * 4 + 3] = rects[i].height;
+	}
+
+	d3d->damage_num = num;
+	return 0;
+}
+
 static const struct display_ops drm_display_ops = {
 	.init = display_init,
 	.destroy = display_destroy,
@@ -349,6 +425,8 @@ static const struct display_ops drm_display_ops = {
 	.use = uterm_drm3d_display_use,
 	.get_buffers = NULL,
 	.swap = display_swap,
+	.get_buffer_age = display_get_buffer_age,
+	.set_damage = display_set_damage,
 	.blit = uterm_drm3d_display_blit,
 	.fake_blendv = uterm_drm3d_display_fake_blendv,
 	.fill = uterm_drm3d_display_fill,
@@ -464,6 +542,18 @@ static int video_init(struct uterm_video *video, const char *node)
 		goto err_disp;
 	}
 
+	if (strstr(ext, "EGL_EXT_buffer_age"))
+		v3d->supports_age = true;
+	else
+		log_debug("EGL_EXT_buffer_age not supported, always doing full redraws");
+
+	if (strstr(ext, "EGL_KHR_swap_buffers_with_damage"))
+		v3d->swap_with_damage = (void*)
+			eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+	else if (strstr(ext, "EGL_EXT_swap_buffers_with_damage"))
+		v3d->swap_with_damage = (void*)
+			eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+
 	api = EGL_OPENGL_ES_API;
 	if (!eglBindAPI(api)) {
 		log_err("cannot bind opengl-es api");
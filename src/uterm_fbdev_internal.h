@@ -53,6 +53,8 @@ struct fbdev_display {
 	size_t len;
 	uint8_t *map;
 	unsigned int stride;
+	unsigned long seq;
+	unsigned long seq_clear;
 
 	bool xrgb32;
 	bool rgb16;
@@ -83,5 +85,9 @@ int uterm_fbdev_display_fill(struct uterm_display *disp,
 			     uint8_t r, uint8_t g, uint8_t b,
 			     unsigned int x, unsigned int y,
 			     unsigned int width, unsigned int height);
+int uterm_fbdev_display_copy(struct uterm_display *disp,
+			     unsigned int x, unsigned int y,
+			     unsigned int width, unsigned int height,
+			     unsigned int dst_x, unsigned int dst_y);
 
 #endif /* UTERM_FBDEV_INTERNAL_H */
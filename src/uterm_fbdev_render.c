@@ -167,16 +167,36 @@ int uterm_fbdev_display_blit(struct uterm_display *disp,
 	return 0;
 }
 
+/* fill the background of a blend request; @val is in device format */
+static void fill_bg(struct fbdev_display *fbdev, uint8_t *dst,
+		    unsigned int width, unsigned int height, uint32_t val)
+{
+	unsigned int i;
+
+	while (height--) {
+		if (fbdev->Bpp == 4) {
+			for (i = 0; i < width; ++i)
+				((uint32_t*)dst)[i] = val;
+		} else if (fbdev->Bpp == 2) {
+			for (i = 0; i < width; ++i)
+				((uint16_t*)dst)[i] = val;
+		}
+		dst += fbdev->stride;
+	}
+}
+
 int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 				    const struct uterm_video_blend_req *req,
 				    size_t num)
 {
 	unsigned int tmp;
 	uint8_t *dst, *src;
-	unsigned int width, height, i, j;
+	unsigned int width, height, i, j, ix, iy;
 	unsigned int r, g, b;
-	uint32_t val;
+	uint32_t val, fgval, bgval;
+	bool mono;
 	struct fbdev_display *fbdev = disp->data;
+	struct mono_lut lut = { .valid = false };
 
 	if (!req)
 		return -EINVAL;
@@ -185,7 +205,8 @@ int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 		if (!req->buf)
 			continue;
 
-		if (req->buf->format != UTERM_FORMAT_GREY)
+		if (req->buf->format != UTERM_FORMAT_GREY &&
+		    req->buf->format != UTERM_FORMAT_MONO)
 			return -EOPNOTSUPP;
 
 		tmp = req->x + req->buf->width;
@@ -210,6 +231,44 @@ int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 			dst = &fbdev->map[fbdev->yres * fbdev->stride];
 		dst = &dst[req->y * fbdev->stride + req->x * fbdev->Bpp];
 		src = req->buf->data;
+		mono = req->buf->format == UTERM_FORMAT_MONO;
+
+		/* mono glyphs and background fills only use two colors, so
+		 * they are converted to the device format once per request
+		 * instead of once per pixel */
+		if (mono || req->ink) {
+			fgval = (req->fr << 16) | (req->fg << 8) | req->fb;
+			bgval = (req->br << 16) | (req->bg << 8) | req->bb;
+			if (!fbdev->xrgb32) {
+				fgval = xrgb32_to_device(disp, fgval);
+				bgval = xrgb32_to_device(disp, bgval);
+			}
+		}
+
+		/* fill the cell once and blend the inked part only */
+		if (req->ink) {
+			fill_bg(fbdev, dst, width, height, bgval);
+			if (!blend_req_ink(req, &ix, &iy, &width, &height))
+				continue;
+			dst += iy * fbdev->stride + ix * fbdev->Bpp;
+			src += iy * req->buf->stride + (mono ? ix / 8 : ix);
+		}
+
+		if (mono) {
+			mono_lut_update(&lut, fgval, bgval);
+
+			if (fbdev->Bpp == 4)
+				mono_blend32(dst, fbdev->stride,
+					     src, req->buf->stride,
+					     width, height, &lut);
+			else if (fbdev->Bpp == 2)
+				mono_blend16(dst, fbdev->stride,
+					     src, req->buf->stride,
+					     width, height, &lut);
+			else
+				log_warning("invalid Bpp");
+			continue;
+		}
 
 		/* Division by 256 instead of 255 increases
 		 * speed by like 20% on slower machines.
@@ -371,3 +430,56 @@ int uterm_fbdev_display_fill(struct uterm_display *disp,
 
 	return 0;
 }
+
+int uterm_fbdev_display_copy(struct uterm_display *disp,
+			     unsigned int x, unsigned int y,
+			     unsigned int width, unsigned int height,
+			     unsigned int dst_x, unsigned int dst_y)
+{
+	unsigned int tmp, i, len;
+	uint8_t *base, *dst, *src;
+	struct fbdev_display *fbdev = disp->data;
+
+	tmp = x + width;
+	if (tmp < x || x >= fbdev->xres || dst_x >= fbdev->xres)
+		return -EINVAL;
+	if (tmp > fbdev->xres)
+		width = fbdev->xres - x;
+	if (dst_x + width > fbdev->xres)
+		width = fbdev->xres - dst_x;
+	tmp = y + height;
+	if (tmp < y || y >= fbdev->yres || dst_y >= fbdev->yres)
+		return -EINVAL;
+	if (tmp > fbdev->yres)
+		height = fbdev->yres - y;
+	if (dst_y + height > fbdev->yres)
+		height = fbdev->yres - dst_y;
+
+	if (!(disp->flags & DISPLAY_DBUF) || fbdev->bufid)
+		base = fbdev->map;
+	else
+		base = &fbdev->map[fbdev->yres * fbdev->stride];
+	src = &base[y * fbdev->stride + x * fbdev->Bpp];
+	dst = &base[dst_y * fbdev->stride + dst_x * fbdev->Bpp];
+	len = width * fbdev->Bpp;
+
+	/* copy in the direction that does not overwrite the source lines
+	 * before they were read */
+	if (dst_y > y) {
+		src += (height - 1) * fbdev->stride;
+		dst += (height - 1) * fbdev->stride;
+		for (i = 0; i < height; ++i) {
+			memmove(dst, src, len);
+			dst -= fbdev->stride;
+			src -= fbdev->stride;
+		}
+	} else {
+		for (i = 0; i < height; ++i) {
+			memmove(dst, src, len);
+			dst += fbdev->stride;
+			src += fbdev->stride;
+		}
+	}
+
+	return 0;
+}
@@ -313,6 +313,7 @@ static int display_activate_force(struct uterm_display *disp,
 	dfb->len = len;
 	dfb->stride = finfo->line_length;
 	dfb->bufid = 0;
+	dfb->seq_clear = dfb->seq;
 	dfb->Bpp = vinfo->bits_per_pixel / 8;
 	dfb->off_r = vinfo->red.offset;
 	dfb->len_r = vinfo->red.length;
@@ -480,6 +481,7 @@ static int display_swap(struct uterm_display *disp, bool immediate)
 	int ret;
 
 	if (!(disp->flags & DISPLAY_DBUF)) {
+		++dfb->seq;
 		if (immediate)
 			return 0;
 		return display_schedule_vblank_timer(disp);
@@ -504,9 +506,27 @@ static int display_swap(struct uterm_display *disp, bool immediate)
 	}
 
 	dfb->bufid ^= 1;
+	++dfb->seq;
 	return display_schedule_vblank_timer(disp);
 }
 
+/* The mapping is cleared on activation and nobody else draws into it while we
+ * are active, so the back-buffer always contains the frame that was swapped
+ * one (single-buffered) or two (double-buffered) swaps ago. */
+static int display_get_buffer_age(struct uterm_display *disp,
+				  unsigned long *seq)
+{
+	struct fbdev_display *dfb = disp->data;
+	unsigned int age;
+
+	age = (disp->flags & DISPLAY_DBUF) ? 2 : 1;
+	*seq = dfb->seq;
+	if (dfb->seq - dfb->seq_clear < age)
+		return 0;
+
+	return age;
+}
+
 static const struct display_ops fbdev_display_ops = {
 	.init = display_init,
 	.destroy = display_destroy,
@@ -516,9 +536,11 @@ static const struct display_ops fbdev_display_ops = {
 	.use = display_use,
 	.get_buffers = display_get_buffers,
 	.swap = display_swap,
+	.get_buffer_age = display_get_buffer_age,
 	.blit = uterm_fbdev_display_blit,
 	.fake_blendv = uterm_fbdev_display_fake_blendv,
 	.fill = uterm_fbdev_display_fill,
+	.copy = uterm_fbdev_display_copy,
 };
 
 static void intro_idle_event(struct ev_eloop *eloop, void *unused, void *data)
@@ -481,6 +481,40 @@ bool uterm_display_is_swapping(struct uterm_display *disp)
 	return disp->vblank_scheduled || (disp->flags & DISPLAY_VSYNC);
 }
 
+/*
+ * Returns the age of the current back-buffer in frames. 0 means the content of
+ * the buffer is undefined and everything must be redrawn, 1 means it contains
+ * the frame that was presented last, and so on. @seq is set to the number of
+ * swaps that have been done on the display so far, which allows callers to
+ * identify the frame that is still present in the buffer.
+ */
+SHL_EXPORT
+int uterm_display_get_buffer_age(struct uterm_display *disp,
+				 unsigned long *seq)
+{
+	if (!disp || !display_is_online(disp) || !seq)
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->get_buffer_age, -EOPNOTSUPP, disp, seq);
+}
+
+/*
+ * Sets the regions that changed since the last frame. This is only a hint for
+ * the next swap and is reset afterwards. Passing no rectangles makes the next
+ * swap a full update again.
+ */
+SHL_EXPORT
+int uterm_display_set_damage(struct uterm_display *disp,
+			     const struct uterm_video_rect *rects,
+			     size_t num)
+{
+	if (!disp || !display_is_online(disp) || (num && !rects))
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->set_damage, -EOPNOTSUPP, disp, rects,
+			  num);
+}
+
 SHL_EXPORT
 int uterm_display_fill(struct uterm_display *disp,
 		       uint8_t r, uint8_t g, uint8_t b,
@@ -494,6 +528,34 @@ int uterm_display_fill(struct uterm_display *disp,
 			  width, height);
 }
 
+/*
+ * Returns true if the display supports uterm_display_copy(). This does not
+ * depend on the display state, so it can be checked once.
+ */
+SHL_EXPORT
+bool uterm_display_can_copy(struct uterm_display *disp)
+{
+	return disp && disp->ops->copy;
+}
+
+/*
+ * Copies the rectangle at @x/@y with size @width/@height inside the back-buffer
+ * to @dst_x/@dst_y. Source and destination may overlap. This allows moving
+ * content that is still present in the back-buffer instead of redrawing it.
+ */
+SHL_EXPORT
+int uterm_display_copy(struct uterm_display *disp,
+		       unsigned int x, unsigned int y,
+		       unsigned int width, unsigned int height,
+		       unsigned int dst_x, unsigned int dst_y)
+{
+	if (!disp || !display_is_online(disp) || !video_is_awake(disp->video))
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->copy, -EOPNOTSUPP, disp, x, y, width,
+			  height, dst_x, dst_y);
+}
+
 SHL_EXPORT
 int uterm_display_blit(struct uterm_display *disp,
 		       const struct uterm_video_buffer *buf,
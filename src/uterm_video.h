@@ -54,6 +54,7 @@
 #include <inttypes.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 struct uterm_mode;
 struct uterm_display;
@@ -100,6 +101,7 @@ enum uterm_video_format {
 	UTERM_FORMAT_GREY	= 0x01,
 	UTERM_FORMAT_XRGB32	= 0x02,
 	UTERM_FORMAT_RGB16	= 0x04,
+	UTERM_FORMAT_MONO	= 0x08,
 };
 
 struct uterm_video_buffer {
@@ -110,8 +112,54 @@ struct uterm_video_buffer {
 	uint8_t *data;
 };
 
+/*
+ * UTERM_FORMAT_MONO buffers store one bit per pixel, most significant bit
+ * first. Set bits are foreground, cleared bits are background. This unpacks
+ * @width pixels of a single row into 8-bit alpha values, one nibble at a time
+ * via a lookup table.
+ */
+#define UTERM_MONO_NIBBLE(n) { \
+		((n) & 8) ? 0xff : 0x00, ((n) & 4) ? 0xff : 0x00, \
+		((n) & 2) ? 0xff : 0x00, ((n) & 1) ? 0xff : 0x00 }
+
+static inline void uterm_video_mono_to_grey(uint8_t *dst, const uint8_t *src,
+					    unsigned int width)
+{
+	static const uint8_t lut[16][4] = {
+		UTERM_MONO_NIBBLE(0), UTERM_MONO_NIBBLE(1),
+		UTERM_MONO_NIBBLE(2), UTERM_MONO_NIBBLE(3),
+		UTERM_MONO_NIBBLE(4), UTERM_MONO_NIBBLE(5),
+		UTERM_MONO_NIBBLE(6), UTERM_MONO_NIBBLE(7),
+		UTERM_MONO_NIBBLE(8), UTERM_MONO_NIBBLE(9),
+		UTERM_MONO_NIBBLE(10), UTERM_MONO_NIBBLE(11),
+		UTERM_MONO_NIBBLE(12), UTERM_MONO_NIBBLE(13),
+		UTERM_MONO_NIBBLE(14), UTERM_MONO_NIBBLE(15),
+	};
+	unsigned int i, full = width / 8;
+
+	for (i = 0; i < full; ++i) {
+		memcpy(&dst[i * 8], lut[src[i] >> 4], 4);
+		memcpy(&dst[i * 8 + 4], lut[src[i] & 0xf], 4);
+	}
+	for (i = full * 8; i < width; ++i)
+		dst[i] = (src[i / 8] & (0x80 >> (i % 8))) ? 0xff : 0x00;
+}
+
+struct uterm_video_rect {
+	unsigned int x;
+	unsigned int y;
+	unsigned int width;
+	unsigned int height;
+};
+
+/*
+ * If @ink is set, only this part of @buf contains set pixels. Backends may fill
+ * the rest of the buffer area with the background color instead of blending
+ * it. An empty @ink means the buffer is background only.
+ */
 struct uterm_video_blend_req {
 	const struct uterm_video_buffer *buf;
+	const struct uterm_video_rect *ink;
 	unsigned int x;
 	unsigned int y;
 	uint8_t fr;
@@ -171,11 +219,21 @@ int uterm_display_get_buffers(struct uterm_display *disp,
 			      unsigned int formats);
 int uterm_display_swap(struct uterm_display *disp, bool immediate);
 bool uterm_display_is_swapping(struct uterm_display *disp);
+int uterm_display_get_buffer_age(struct uterm_display *disp,
+				 unsigned long *seq);
+int uterm_display_set_damage(struct uterm_display *disp,
+			     const struct uterm_video_rect *rects,
+			     size_t num);
 
 int uterm_display_fill(struct uterm_display *disp,
 		       uint8_t r, uint8_t g, uint8_t b,
 		       unsigned int x, unsigned int y,
 		       unsigned int width, unsigned int height);
+bool uterm_display_can_copy(struct uterm_display *disp);
+int uterm_display_copy(struct uterm_display *disp,
+		       unsigned int x, unsigned int y,
+		       unsigned int width, unsigned int height,
+		       unsigned int dst_x, unsigned int dst_y);
 int uterm_display_blit(struct uterm_display *disp,
 		       const struct uterm_video_buffer *buf,
 		       unsigned int x, unsigned int y);
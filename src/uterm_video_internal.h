@@ -32,6 +32,7 @@
 #include <limits.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include "eloop.h"
 #include "shl_dlist.h"
 #include "shl_hook.h"
@@ -58,6 +59,11 @@ struct display_ops {
 			    struct uterm_video_buffer *buffer,
 			    unsigned int formats);
 	int (*swap) (struct uterm_display *disp, bool immediate);
+	int (*get_buffer_age) (struct uterm_display *disp,
+			       unsigned long *seq);
+	int (*set_damage) (struct uterm_display *disp,
+			   const struct uterm_video_rect *rects,
+			   size_t num);
 	int (*blit) (struct uterm_display *disp,
 		     const struct uterm_video_buffer *buf,
 		     unsigned int x, unsigned int y);
@@ -67,6 +73,10 @@ struct display_ops {
 	int (*fill) (struct uterm_display *disp,
 		     uint8_t r, uint8_t g, uint8_t b, unsigned int x,
 		     unsigned int y, unsigned int width, unsigned int height);
+	int (*copy) (struct uterm_display *disp,
+		     unsigned int x, unsigned int y,
+		     unsigned int width, unsigned int height,
+		     unsigned int dst_x, unsigned int dst_y);
 };
 
 struct video_ops {
@@ -180,6 +190,123 @@ static inline bool video_need_hotplug(const struct uterm_video *video)
 			.action = (act), \
 		})
 
+/* mono blending */
+
+/*
+ * UTERM_FORMAT_MONO buffers are blended with nibble lookup tables: each entry
+ * holds the four device pixels for one nibble of the bitmap, so expansion is
+ * two table lookups and copies per source byte without any arithmetic. The
+ * tables depend on the colors only and are rebuilt when they change, which
+ * usually happens only a few times per frame.
+ */
+
+struct mono_lut {
+	bool valid;
+	uint32_t fg;
+	uint32_t bg;
+	uint32_t pix32[16][4];
+	uint16_t pix16[16][4];
+};
+
+static inline void mono_lut_update(struct mono_lut *lut, uint32_t fg,
+				   uint32_t bg)
+{
+	unsigned int i, j;
+
+	if (lut->valid && lut->fg == fg && lut->bg == bg)
+		return;
+
+	for (i = 0; i < 16; ++i) {
+		for (j = 0; j < 4; ++j) {
+			lut->pix32[i][j] = (i & (8 >> j)) ? fg : bg;
+			lut->pix16[i][j] = lut->pix32[i][j];
+		}
+	}
+
+	lut->fg = fg;
+	lut->bg = bg;
+	lut->valid = true;
+}
+
+static inline void mono_blend32(uint8_t *dst, unsigned int stride,
+				const uint8_t *src, unsigned int src_stride,
+				unsigned int width, unsigned int height,
+				const struct mono_lut *lut)
+{
+	uint32_t *d;
+	unsigned int i, full = width / 8;
+
+	while (height--) {
+		d = (uint32_t*)dst;
+		for (i = 0; i < full; ++i) {
+			memcpy(&d[i * 8], lut->pix32[src[i] >> 4], 16);
+			memcpy(&d[i * 8 + 4], lut->pix32[src[i] & 0xf], 16);
+		}
+		for (i = full * 8; i < width; ++i)
+			d[i] = (src[i / 8] & (0x80 >> (i % 8))) ?
+							lut->fg : lut->bg;
+		dst += stride;
+		src += src_stride;
+	}
+}
+
+static inline void mono_blend16(uint8_t *dst, unsigned int stride,
+				const uint8_t *src, unsigned int src_stride,
+				unsigned int width, unsigned int height,
+				const struct mono_lut *lut)
+{
+	uint16_t *d;
+	unsigned int i, full = width / 8;
+
+	while (height--) {
+		d = (uint16_t*)dst;
+		for (i = 0; i < full; ++i) {
+			memcpy(&d[i * 8], lut->pix16[src[i] >> 4], 8);
+			memcpy(&d[i * 8 + 4], lut->pix16[src[i] & 0xf], 8);
+		}
+		for (i = full * 8; i < width; ++i)
+			d[i] = (src[i / 8] & (0x80 >> (i % 8))) ?
+							lut->fg : lut->bg;
+		dst += stride;
+		src += src_stride;
+	}
+}
+
+/*
+ * Clip the ink box of @req to the visible @width x @height part of its buffer.
+ * Returns false if nothing inside is inked. Otherwise @x, @y, @width and
+ * @height describe the part that still needs blending. Mono ink boxes always
+ * start at a byte boundary.
+ */
+static inline bool blend_req_ink(const struct uterm_video_blend_req *req,
+				 unsigned int *x, unsigned int *y,
+				 unsigned int *width, unsigned int *height)
+{
+	const struct uterm_video_rect *ink = req->ink;
+
+	*x = 0;
+	*y = 0;
+	if (!ink)
+		return true;
+
+	if (!ink->width || !ink->height ||
+	    ink->x >= *width || ink->y >= *height)
+		return false;
+
+	*x = ink->x;
+	*y = ink->y;
+	if (ink->width < *width - ink->x)
+		*width = ink->width;
+	else
+		*width -= ink->x;
+	if (ink->height < *height - ink->y)
+		*height = ink->height;
+	else
+		*height -= ink->y;
+
+	return true;
+}
+
 #if defined(BUILD_ENABLE_VIDEO_DRM3D) || defined(BUILD_ENABLE_VIDEO_DRM2D)
 
 #include <xf86drm.h>
@@ -1,8 +1,7 @@
 /*
- * kmscon - Fragment Shader
+ * kmscon - Common benchmark functions
  *
- * Copyright (c) 2011-2012 David Herrmann <dh.herrmann@googlemail.com>
- * Copyright (c) 2011 University of Tuebingen
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
  *
  * Permission is hereby granted, free of charge, to any person obtaining
  * a copy of this software and associated documentation files
@@ -25,15 +24,29 @@
  */
 
 /*
- * Default Fragment Shader
- * A basic fragment shader which applies a color directly.
+ * Timing and input generation for the benchmarks. Unlike test_include.h this
+ * does not need the config parser or an event loop.
  */
 
-precision mediump float;
+#include <stdint.h>
+#include <time.h>
 
-varying vec4 col;
+static inline uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
 
-void main()
+/* xorshift, deterministic so runs are comparable */
+static inline uint32_t next_rand(uint32_t *state)
 {
-	gl_FragColor = col;
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
 }
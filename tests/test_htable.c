@@ -0,0 +1,235 @@
+/*
+ * test_htable - Compare glyph hashtable implementations
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Hashtable Benchmark
+ * This fills shl_hashtable and shl_u32map with the same set of glyph ids and
+ * measures insertion, lookup and removal. The ids are a mix of code-points and
+ * large combined-character ids like the ones tsm hands to the renderers.
+ * Both tables are checked against each other so this also serves as a simple
+ * correctness test for shl_u32map.
+ *
+ * Usage: test_htable [<number of ids> [<lookup rounds>]]
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shl_hashtable.h"
+#include "shl_u32map.h"
+#include "test_bench.h"
+
+struct value {
+	uint32_t id;
+};
+
+SHL_U32MAP_DEFINE(value_map, struct value)
+
+static void print_result(const char *name, const char *op, uint64_t ns,
+			 unsigned long num)
+{
+	printf("%-14s %-7s %10.2f ms  %7.2f ns/op\n", name, op,
+	       ns / 1000000.0, (double)ns / num);
+}
+
+static void fill_ids(struct value *vals, unsigned long num)
+{
+	unsigned long i;
+	uint32_t state = 0x12345678, r;
+
+	for (i = 0; i < num; ++i) {
+		r = next_rand(&state);
+		if (i < 95)
+			vals[i].id = 0x20 + i;
+		else if (r % 4 == 0)
+			vals[i].id = 0x110000 + i;
+		else
+			vals[i].id = 0x100 + i * 7;
+	}
+}
+
+static int test_shl_hashtable(struct value *vals, unsigned long num,
+			      unsigned long rounds)
+{
+	struct shl_hashtable *tbl;
+	struct value *v;
+	unsigned long i, j;
+	uint64_t start;
+	int ret;
+	bool res;
+
+	ret = shl_hashtable_new(&tbl, shl_direct_hash, shl_direct_equal,
+				NULL, NULL);
+	if (ret)
+		return ret;
+
+	start = now_ns();
+	for (i = 0; i < num; ++i) {
+		ret = shl_hashtable_insert(tbl, (void*)(long)vals[i].id,
+					   &vals[i]);
+		if (ret)
+			goto err_free;
+	}
+	print_result("shl_hashtable", "insert", now_ns() - start, num);
+
+	start = now_ns();
+	for (j = 0; j < rounds; ++j) {
+		for (i = 0; i < num; ++i) {
+			res = shl_hashtable_find(tbl, (void**)&v,
+						 (void*)(long)vals[i].id);
+			if (!res || v != &vals[i]) {
+				fprintf(stderr, "shl_hashtable: lookup of %" PRIu32 " failed\n",
+					vals[i].id);
+				ret = -EFAULT;
+				goto err_free;
+			}
+		}
+	}
+	print_result("shl_hashtable", "find", now_ns() - start, num * rounds);
+
+	start = now_ns();
+	for (i = 0; i < num; ++i)
+		shl_hashtable_remove(tbl, (void*)(long)vals[i].id);
+	print_result("shl_hashtable", "remove", now_ns() - start, num);
+
+	ret = 0;
+err_free:
+	shl_hashtable_free(tbl);
+	return ret;
+}
+
+static int test_shl_u32map(struct value *vals, unsigned long num,
+			   unsigned long rounds)
+{
+	struct value_map map;
+	struct value *v;
+	unsigned long i, j;
+	uint64_t start;
+	int ret;
+
+	value_map_init(&map);
+
+	start = now_ns();
+	for (i = 0; i < num; ++i) {
+		ret = value_map_insert(&map, vals[i].id, &vals[i]);
+		if (ret)
+			goto err_free;
+	}
+	print_result("shl_u32map", "insert", now_ns() - start, num);
+
+	if (value_map_insert(&map, vals[0].id, &vals[0]) != -EALREADY) {
+		fprintf(stderr, "shl_u32map: duplicate insertion succeeded\n");
+		ret = -EFAULT;
+		goto err_free;
+	}
+
+	start = now_ns();
+	for (j = 0; j < rounds; ++j) {
+		for (i = 0; i < num; ++i) {
+			v = value_map_find(&map, vals[i].id);
+			if (v != &vals[i]) {
+				fprintf(stderr, "shl_u32map: lookup of %" PRIu32 " failed\n",
+					vals[i].id);
+				ret = -EFAULT;
+				goto err_free;
+			}
+		}
+	}
+	print_result("shl_u32map", "find", now_ns() - start, num * rounds);
+
+	/* remove every other id first so removal shifts occupied clusters */
+	start = now_ns();
+	for (i = 0; i < num; i += 2) {
+		if (value_map_remove(&map, vals[i].id) != &vals[i]) {
+			fprintf(stderr, "shl_u32map: removal of %" PRIu32 " failed\n",
+				vals[i].id);
+			ret = -EFAULT;
+			goto err_free;
+		}
+	}
+	for (i = 1; i < num; i += 2) {
+		if (value_map_find(&map, vals[i].id) != &vals[i] ||
+		    value_map_find(&map, vals[i - 1].id)) {
+			fprintf(stderr, "shl_u32map: table corrupted by removal\n");
+			ret = -EFAULT;
+			goto err_free;
+		}
+		value_map_remove(&map, vals[i].id);
+	}
+	print_result("shl_u32map", "remove", now_ns() - start, num);
+
+	if (map.num) {
+		fprintf(stderr, "shl_u32map: %zu entries left\n", map.num);
+		ret = -EFAULT;
+		goto err_free;
+	}
+
+	ret = 0;
+err_free:
+	value_map_clear(&map, NULL);
+	return ret;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long num = 4096, rounds = 256;
+	struct value *vals;
+	int ret;
+
+	if (argc > 1)
+		num = strtoul(argv[1], NULL, 10);
+	if (argc > 2)
+		rounds = strtoul(argv[2], NULL, 10);
+	if (num < 96)
+		num = 96;
+	if (!rounds)
+		rounds = 1;
+
+	vals = calloc(num, sizeof(*vals));
+	if (!vals) {
+		fprintf(stderr, "cannot allocate %lu ids\n", num);
+		return EXIT_FAILURE;
+	}
+
+	fill_ids(vals, num);
+	printf("%lu ids, %lu lookup rounds\n", num, rounds);
+
+	ret = test_shl_hashtable(vals, num, rounds);
+	if (!ret)
+		ret = test_shl_u32map(vals, num, rounds);
+
+	free(vals);
+
+	if (ret) {
+		fprintf(stderr, "test failed (%d)\n", ret);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
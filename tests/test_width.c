@@ -0,0 +1,135 @@
+/*
+ * test_width - Compare character width lookups
+ *
+ * Copyright (c) 2012-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Character Width Benchmark
+ * This compares the generated two-level width table of src/font_width.h with
+ * tsm_ucs4_get_width() which binary-searches interval tables. All code-points
+ * are checked first, so this also verifies that the table is in sync with the
+ * libtsm kmscon is built against. Run it after updating the Unicode tables.
+ *
+ * Usage: test_width [<lookup rounds>]
+ */
+
+#include <inttypes.h>
+#include <libtsm.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "font_width.h"
+#include "test_bench.h"
+
+#define TEXT_LEN 4096
+
+static void print_result(const char *name, uint64_t ns, unsigned long num,
+			 unsigned long sum)
+{
+	printf("%-20s %10.2f ms  %7.2f ns/op  (sum %lu)\n", name,
+	       ns / 1000000.0, (double)ns / num, sum);
+}
+
+/* mostly ASCII and latin with some CJK and combining marks, like a terminal */
+static void fill_text(uint32_t *text)
+{
+	unsigned int i;
+	uint32_t state = 0x12345678, r;
+
+	for (i = 0; i < TEXT_LEN; ++i) {
+		r = next_rand(&state);
+		switch (r % 16) {
+		case 0:
+			text[i] = 0x4e00 + (r >> 8) % 0x5000;
+			break;
+		case 1:
+			text[i] = 0x300 + (r >> 8) % 0x70;
+			break;
+		case 2:
+			text[i] = 0xa0 + (r >> 8) % 0x2000;
+			break;
+		default:
+			text[i] = 0x20 + (r >> 8) % 0x5f;
+			break;
+		}
+	}
+}
+
+static int verify(void)
+{
+	uint32_t i;
+	unsigned int w1, w2;
+
+	for (i = 0; i < KMSCON_WIDTH_MAX; ++i) {
+		w1 = tsm_ucs4_get_width(i);
+		w2 = kmscon_ucs4_get_width(i);
+		if (w1 != w2) {
+			fprintf(stderr, "width of U+%04" PRIX32 " differs: tsm %u, table %u\n",
+				i, w1, w2);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	static uint32_t text[TEXT_LEN];
+	unsigned long rounds = 4096, i, sum;
+	unsigned int j;
+	uint64_t start;
+
+	if (argc > 1)
+		rounds = strtoul(argv[1], NULL, 10);
+	if (!rounds)
+		rounds = 1;
+
+	if (verify()) {
+		fprintf(stderr, "width table out of sync with libtsm\n");
+		return EXIT_FAILURE;
+	}
+	printf("all %u code-points match\n", KMSCON_WIDTH_MAX);
+
+	fill_text(text);
+	printf("%u characters, %lu rounds\n", TEXT_LEN, rounds);
+
+	sum = 0;
+	start = now_ns();
+	for (i = 0; i < rounds; ++i) {
+		for (j = 0; j < TEXT_LEN; ++j)
+			sum += tsm_ucs4_get_width(text[j]);
+	}
+	print_result("tsm_ucs4_get_width", now_ns() - start, rounds * TEXT_LEN,
+		     sum);
+
+	sum = 0;
+	start = now_ns();
+	for (i = 0; i < rounds; ++i) {
+		for (j = 0; j < TEXT_LEN; ++j)
+			sum += kmscon_ucs4_get_width(text[j]);
+	}
+	print_result("width table", now_ns() - start, rounds * TEXT_LEN, sum);
+
+	return EXIT_SUCCESS;
+}